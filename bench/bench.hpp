@@ -0,0 +1,178 @@
+/* bench.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __BENCH_HPP__
+# define __BENCH_HPP__
+
+# include "ft/trace.hpp"
+# include <time.h>
+# include <stdint.h>
+# include <stdio.h>
+# include <string.h>
+
+/* Helpers shared by the benchmarks of this directory. Each benchmark is a
+ * single program built from the root of the repository, with the command
+ * given at the top of its file.
+ */
+
+/* Monotonic time in seconds. */
+inline double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Monotonic time in nanoseconds, for timing short operations. */
+inline uint64_t bench_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* Keeps the compiler from dropping the computation of x. */
+template <typename T>
+inline void bench_keep(T const &x)
+{
+	__asm__ __volatile__("" : : "g"(&x) : "memory");
+}
+
+/* xorshift64, the same sequence on every run. */
+struct bench_random
+{
+	uint64_t	state;
+
+	explicit bench_random(uint64_t seed = 88172645463325252ULL) : state(seed) { }
+
+	uint64_t operator()(void)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+};
+
+/* Latencies in buckets of 1/16 of a power of two, so every bucket is
+ * within 6% of the values it holds.
+ */
+struct latency_histogram
+{
+	enum { sub = 16, buckets = sub * 64 };
+
+	uint64_t	count[buckets];
+	uint64_t	total;
+	uint64_t	worst;
+
+	latency_histogram(void) : total(0), worst(0) { memset(count, 0, sizeof(count)); }
+
+	void add(uint64_t ns)
+	{
+		++count[bucket(ns)];
+		++total;
+		if (ns > worst)
+			worst = ns;
+	}
+
+	void merge(latency_histogram const &h)
+	{
+		for (size_t b = 0; b < buckets; ++b)
+			count[b] += h.count[b];
+		total += h.total;
+		if (h.worst > worst)
+			worst = h.worst;
+	}
+
+	/* The smallest latency that q of the samples do not exceed. */
+	uint64_t percentile(double q) const
+	{
+		uint64_t rank = static_cast<uint64_t>(q * total);
+		uint64_t seen = 0;
+
+		for (size_t b = 0; b < buckets; ++b) {
+			seen += count[b];
+			if (seen > rank)
+				return upper(b);
+		}
+		return worst;
+	}
+
+	static size_t bucket(uint64_t ns)
+	{
+		if (ns < sub)
+			return ns;
+
+		int e = 63 - __builtin_clzll(ns);
+
+		return sub * (e - 3) + (ns >> (e - 4) & (sub - 1));
+	}
+
+	/* The power of two below the latencies of bucket b. */
+	static int power(size_t b)
+	{
+		if (b < sub)
+			return b ? 63 - __builtin_clzll(b) : 0;
+		return b / sub + 3;
+	}
+
+	/* The largest latency of bucket b. */
+	static uint64_t upper(size_t b)
+	{
+		if (b < sub)
+			return b;
+
+		return ((sub + b % sub + 1) << (power(b) - 4)) - 1;
+	}
+};
+
+/* Prints the percentiles of h, then the number of samples per power of
+ * two of nanoseconds.
+ */
+inline void bench_report(char const *name, latency_histogram const &h)
+{
+	static double const	q[] = { 0.5, 0.9, 0.99, 0.999, 0.9999 };
+	static char const	*label[] = { "p50", "p90", "p99", "p999", "p9999" };
+
+	printf("%s\n ", name);
+	for (size_t i = 0; i < sizeof(q) / sizeof(*q); ++i)
+		printf(" %s %llu ns", label[i], (unsigned long long)h.percentile(q[i]));
+	printf("  max %llu ns\n", (unsigned long long)h.worst);
+
+	/* one line per power of two */
+	uint64_t per_power[64] = { 0 };
+
+	for (size_t b = 0; b < latency_histogram::buckets; ++b)
+		per_power[latency_histogram::power(b)] += h.count[b];
+	for (int e = 0; e < 64; ++e) {
+		if (per_power[e])
+			printf("  < %10llu ns %10llu\n", 2ULL << e, (unsigned long long)per_power[e]);
+	}
+}
+
+/* Prints the events that the containers using ft::operation_trace
+ * counted since before, per operation of the ops run in between, and
+ * returns the counts of now for the next reading:
+ *
+ *   ft::trace_counts t = ft::operation_trace::global();
+ *   ... n lookups ...
+ *   t = bench_trace("find", t, n);
+ *
+ * The counters cost an atomic add per event, so run the traced
+ * containers apart from the timed ones.
+ */
+inline ft::trace_counts bench_trace(char const *name, ft::trace_counts const &before, double ops)
+{
+	ft::trace_counts now = ft::operation_trace::global();
+	ft::trace_counts d = now - before;
+
+	printf("%s, per op: %.2f copies, %.2f destructions, %.2f comparisons, %.4f allocations\n",
+		name, d.copies / ops, d.destructions / ops, d.comparisons / ops, d.allocations / ops);
+	return now;
+}
+
+#endif /* __BENCH_HPP__ */
@@ -0,0 +1,198 @@
+/* bounded_queue.cpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ *
+ * Throughput of spsc_queue (1 producer, 1 consumer) and mpmc_queue
+ * (2 producers, 2 consumers by default) with 1024 slots, pushing and
+ * popping one element at a time, then in batches of 32. Then the
+ * latency of every element, from its push to its pop, one at a time.
+ *
+ *   g++ -std=c++98 -O2 -I. bench/bounded_queue.cpp -o bounded_queue -lpthread
+ *   ./bounded_queue [producers consumers]
+ *
+ * Thread i is pinned to CPU i modulo the number of CPUs, so producers
+ * and consumers run on different cores when there are enough of them.
+ * A thread that finds the queue full or empty yields its CPU, so the
+ * numbers also hold when there are fewer CPUs than threads; they then
+ * measure the queue under time slicing rather than across cores. The
+ * producers push as fast as they can, so the latency includes the time
+ * an element waits behind the others in the queue.
+ */
+
+#include "ft/bounded_queue.hpp"
+#include "bench/bench.hpp"
+#include <algorithm>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+static long const	elements = 1 << 22;
+static int const	slots = 1024;
+
+/* Starts f(arg) on a thread pinned to CPU i, or to CPU i modulo the
+ * number of CPUs.
+ */
+static pthread_t start_pinned(void *(*f)(void *), void *arg, long i)
+{
+	static long const	cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	pthread_attr_t		attr;
+	cpu_set_t			set;
+	pthread_t			thread;
+
+	CPU_ZERO(&set);
+	CPU_SET(i % cpus, &set);
+	pthread_attr_init(&attr);
+	pthread_attr_setaffinity_np(&attr, sizeof(set), &set);
+	pthread_create(&thread, &attr, f, arg);
+	pthread_attr_destroy(&attr);
+	return thread;
+}
+
+template <class Queue>
+struct queue_bench
+{
+	Queue				queue;
+	long				per_producer;
+	long				per_consumer;
+	long				batch;
+	long				consumers;		/* started so far */
+	latency_histogram	latency[64];	/* of every consumer, when timed */
+
+	queue_bench(long producers, long consumers, long b)
+		: queue(slots)
+		, per_producer(elements / producers)
+		, per_consumer(elements / consumers)
+		, batch(b)
+		, consumers(0)
+	{ }
+
+	/* Pushes the time of each push instead of a counter. */
+	static void *produce_timed(void *arg)
+	{
+		queue_bench *self = static_cast<queue_bench *>(arg);
+
+		for (long i = 0; i < self->per_producer; ) {
+			if (self->queue.push(bench_ns()))
+				++i;
+			else
+				sched_yield();
+		}
+		return 0;
+	}
+
+	/* Adds the time since the push of each element to the histogram
+	 * of the consumer.
+	 */
+	static void *consume_timed(void *arg)
+	{
+		queue_bench			*self = static_cast<queue_bench *>(arg);
+		latency_histogram	&h = self->latency[__atomic_fetch_add(&self->consumers, 1, __ATOMIC_RELAXED)];
+		long				pushed;
+
+		for (long i = 0; i < self->per_consumer; ) {
+			if (self->queue.pop(pushed)) {
+				h.add(bench_ns() - pushed);
+				++i;
+			} else
+				sched_yield();
+		}
+		return 0;
+	}
+
+	static void *produce(void *arg)
+	{
+		queue_bench	*self = static_cast<queue_bench *>(arg);
+		long		buffer[32];
+
+		for (long i = 0; i < self->per_producer; ) {
+			long n = std::min(self->batch, self->per_producer - i);
+
+			for (long k = 0; k < n; ++k)
+				buffer[k] = i + k;
+
+			long pushed = self->batch == 1
+				? self->queue.push(buffer[0])
+				: self->queue.push_n(buffer, n);
+
+			if (!pushed)
+				sched_yield();
+			i += pushed;
+		}
+		return 0;
+	}
+
+	static void *consume(void *arg)
+	{
+		queue_bench	*self = static_cast<queue_bench *>(arg);
+		long		buffer[32];
+		long		sum = 0;
+
+		for (long i = 0; i < self->per_consumer; ) {
+			long n = std::min(self->batch, self->per_consumer - i);
+			long popped = self->batch == 1
+				? self->queue.pop(buffer[0])
+				: self->queue.pop_n(buffer, n);
+
+			if (!popped)
+				sched_yield();
+			for (long k = 0; k < popped; ++k)
+				sum += buffer[k];
+			i += popped;
+		}
+		bench_keep(sum);
+		return 0;
+	}
+};
+
+template <class Queue>
+static void run(char const *name, long producers, long consumers, long batch)
+{
+	typedef queue_bench<Queue>	bench_type;
+
+	bench_type	*bench = new bench_type(producers, consumers, batch);
+	pthread_t	threads[64];
+	bool		timed = batch == 0;
+	double		start = bench_now();
+
+	for (long i = 0; i < producers; ++i)
+		threads[i] = start_pinned(timed ? bench_type::produce_timed : bench_type::produce, bench, i);
+	for (long i = producers; i < producers + consumers; ++i)
+		threads[i] = start_pinned(timed ? bench_type::consume_timed : bench_type::consume, bench, i);
+	for (long i = 0; i < producers + consumers; ++i)
+		pthread_join(threads[i], 0);
+	if (timed) {
+		char title[64];
+
+		for (long i = 1; i < consumers; ++i)
+			bench->latency[0].merge(bench->latency[i]);
+		snprintf(title, sizeof(title), "%s %ldx%ld, latency", name, producers, consumers);
+		bench_report(title, bench->latency[0]);
+	} else
+		printf("%s %ldx%ld, batch %2ld: %6.1f Mops/s\n", name, producers, consumers, batch,
+			elements / (bench_now() - start) / 1e6);
+	delete bench;
+}
+
+int main(int argc, char **argv)
+{
+	long producers = argc == 3 ? atol(argv[1]) : 2;
+	long consumers = argc == 3 ? atol(argv[2]) : 2;
+
+	/* every consumer must get as many elements as it waits for */
+	if (producers < 1 || consumers < 1 || producers + consumers > 64
+		|| elements % producers || elements % consumers) {
+		fprintf(stderr, "usage: %s [producers consumers], powers of two up to 64\n", argv[0]);
+		return 1;
+	}
+	run<ft::spsc_queue<long> >("spsc", 1, 1, 1);
+	run<ft::spsc_queue<long> >("spsc", 1, 1, 32);
+	run<ft::mpmc_queue<long> >("mpmc", producers, consumers, 1);
+	run<ft::mpmc_queue<long> >("mpmc", producers, consumers, 32);
+
+	/* batch 0: one at a time, timed */
+	run<ft::spsc_queue<long> >("spsc", 1, 1, 0);
+	run<ft::mpmc_queue<long> >("mpmc", producers, consumers, 0);
+	return 0;
+}
@@ -0,0 +1,118 @@
+/* caching_allocator.cpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ *
+ * Node throughput of ft::map<int, int> with std::allocator and with
+ * caching_allocator: each of 1 to 32 threads builds and destroys
+ * 1000-node maps. Then one thread allocates blocks and hands them
+ * through an spsc_queue to another that frees them.
+ *
+ *   g++ -std=c++98 -O2 -I. bench/caching_allocator.cpp -o caching_allocator -lpthread
+ */
+
+#include "ft/caching_allocator.hpp"
+#include "ft/bounded_queue.hpp"
+#include "ft/map.hpp"
+#include "bench/bench.hpp"
+#include <memory>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+static int const	nodes_per_thread = 2000000;
+static long const	handed_over = 2000000;
+
+template <class Allocator>
+static void *build_maps(void *)
+{
+	typedef ft::map<int, int, ft::less<int>, Allocator>	map_type;
+
+	for (int r = 0; r < nodes_per_thread / 1000; ++r) {
+		map_type map;
+
+		for (int i = 0; i < 1000; ++i)
+			map.insert(ft::make_pair(i * 7919 % 1000, i));
+		bench_keep(map.size());
+	}
+	return 0;
+}
+
+/* Million nodes allocated and freed per second over all the threads. */
+template <class Allocator>
+static double run(int threads)
+{
+	pthread_t	thread[32];
+	double		start = bench_now();
+
+	for (int i = 0; i < threads; ++i)
+		pthread_create(&thread[i], 0, build_maps<Allocator>, 0);
+	for (int i = 0; i < threads; ++i)
+		pthread_join(thread[i], 0);
+	return static_cast<double>(nodes_per_thread) * threads / (bench_now() - start) / 1e6;
+}
+
+/* A block of the size of a map node. */
+struct node_block
+{
+	long	words[6];
+};
+
+typedef ft::caching_allocator<node_block>	block_allocator;
+
+static ft::spsc_queue<node_block *>	*queue;
+
+static void *produce(void *)
+{
+	block_allocator alloc;
+
+	for (long i = 0; i < handed_over; ++i) {
+		node_block *b = alloc.allocate(1);
+
+		b->words[0] = i;
+		while (!queue->push(b))
+			sched_yield();
+	}
+	return 0;
+}
+
+static void *consume(void *)
+{
+	block_allocator	alloc;
+	node_block		*b;
+
+	for (long i = 0; i < handed_over; ) {
+		if (!queue->pop(b)) {
+			sched_yield();
+			continue ;
+		}
+		bench_keep(b->words[0]);
+		alloc.deallocate(b, 1);
+		++i;
+	}
+	return 0;
+}
+
+int main(void)
+{
+	typedef ft::pair<const int, int>	value_type;
+
+	printf("threads  std::allocator  caching_allocator  (Mnodes/s)\n");
+	for (int threads = 1; threads <= 32; threads *= 2)
+		printf("%7d  %14.1f  %17.1f\n", threads,
+			run<std::allocator<value_type> >(threads),
+			run<ft::caching_allocator<value_type> >(threads));
+
+	pthread_t	producer;
+	pthread_t	consumer;
+	double		start = bench_now();
+
+	queue = new ft::spsc_queue<node_block *>(1024);
+	pthread_create(&producer, 0, produce, 0);
+	pthread_create(&consumer, 0, consume, 0);
+	pthread_join(producer, 0);
+	pthread_join(consumer, 0);
+	printf("allocated on one thread, freed on another: %.1f M/s\n",
+		handed_over / (bench_now() - start) / 1e6);
+	delete queue;
+	return 0;
+}
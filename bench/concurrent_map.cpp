@@ -0,0 +1,173 @@
+/* concurrent_map.cpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ *
+ * Lookups per second of 1 to 32 readers while one writer inserts, erases
+ * and assigns int -> string elements, in concurrent_map and in an
+ * ft::map behind a mutex. There are 100000 keys, half of them in the map
+ * at the start.
+ *
+ *   g++ -std=c++98 -O2 -I. bench/concurrent_map.cpp -o concurrent_map -lpthread
+ *   ./concurrent_map [lookups per reader]
+ *
+ * The writer yields its CPU every 64 writes, so the numbers also hold
+ * when there are fewer CPUs than threads; they then measure the cost of
+ * a lookup under time slicing rather than scaling across cores.
+ */
+
+#include "ft/concurrent_map.hpp"
+#include "ft/map.hpp"
+#include "bench/bench.hpp"
+#include <string>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static int const	keys = 100000;
+static long			lookups = 200000;
+
+static std::string value(long v)
+{
+	char buffer[32];
+
+	sprintf(buffer, "%ld", v);
+	return buffer;
+}
+
+/* Both maps behind the same interface: lookup returns whether k is in
+ * the map, write does insert, erase or assign depending on op.
+ */
+struct lock_free_map
+{
+	typedef ft::concurrent_map<int, std::string>	map_type;
+
+	map_type	map;
+
+	bool lookup(int k)
+	{
+		ft::epoch_guard guard;
+
+		return map.find(k) != map.end();
+	}
+
+	void write(int op, int k, long v)
+	{
+		if (op == 0)
+			map.insert(ft::make_pair(k, value(v)));
+		else if (op == 1)
+			map.erase(k);
+		else
+			map.insert_or_assign(k, value(v));
+	}
+};
+
+struct locked_map
+{
+	typedef ft::map<int, std::string>	map_type;
+
+	map_type		map;
+	pthread_mutex_t	lock;
+
+	locked_map(void) { pthread_mutex_init(&lock, 0); }
+	~locked_map(void) { pthread_mutex_destroy(&lock); }
+
+	bool lookup(int k)
+	{
+		pthread_mutex_lock(&lock);
+
+		bool found = map.find(k) != map.end();
+
+		pthread_mutex_unlock(&lock);
+		return found;
+	}
+
+	void write(int op, int k, long v)
+	{
+		pthread_mutex_lock(&lock);
+		if (op == 0)
+			map.insert(ft::make_pair(k, value(v)));
+		else if (op == 1)
+			map.erase(k);
+		else
+			map[k] = value(v);
+		pthread_mutex_unlock(&lock);
+	}
+};
+
+template <class Map>
+struct map_bench
+{
+	Map				map;
+	volatile int	stop;
+	long			writes;
+
+	map_bench(void) : stop(0), writes(0)
+	{
+		for (int k = 0; k < keys; k += 2)
+			map.write(0, k, 0);
+	}
+
+	static void *read(void *arg)
+	{
+		map_bench		*self = static_cast<map_bench *>(arg);
+		bench_random	random(static_cast<uint64_t>(pthread_self()) | 1);
+		long			found = 0;
+
+		for (long i = 0; i < lookups; ++i)
+			found += self->map.lookup(random() % keys);
+		bench_keep(found);
+		return 0;
+	}
+
+	static void *write(void *arg)
+	{
+		map_bench		*self = static_cast<map_bench *>(arg);
+		bench_random	random;
+		long			n = 0;
+
+		while (!self->stop) {
+			uint64_t r = random();
+
+			self->map.write(r % 3, (r >> 8) % keys, n);
+			if (++n % 64 == 0)
+				sched_yield();
+		}
+		self->writes = n;
+		return 0;
+	}
+};
+
+template <class Map>
+static void run(char const *name, int readers)
+{
+	map_bench<Map>	*bench = new map_bench<Map>;
+	pthread_t		threads[32];
+	pthread_t		writer;
+	double			start = bench_now();
+
+	for (int i = 0; i < readers; ++i)
+		pthread_create(&threads[i], 0, map_bench<Map>::read, bench);
+	pthread_create(&writer, 0, map_bench<Map>::write, bench);
+	for (int i = 0; i < readers; ++i)
+		pthread_join(threads[i], 0);
+
+	double elapsed = bench_now() - start;
+
+	bench->stop = 1;
+	pthread_join(writer, 0);
+	printf("%2d readers, %s: %5.2f M lookups/s, writer %5.2f M ops/s\n", readers, name,
+		readers * lookups / elapsed / 1e6, bench->writes / elapsed / 1e6);
+	delete bench;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc > 1)
+		lookups = atol(argv[1]);
+	for (int readers = 1; readers <= 32; readers *= 2) {
+		run<lock_free_map>("concurrent_map ", readers);
+		run<locked_map>("mutex + ft::map", readers);
+	}
+	return 0;
+}
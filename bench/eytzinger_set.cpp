@@ -0,0 +1,70 @@
+/* eytzinger_set.cpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ *
+ * 2M random lookups of int keys in n keys (1M by default): lower_bound
+ * on the sorted ft::vector, rank on an eytzinger_set built from it, and
+ * lower_bound on an ft::map unless "nomap" is given, for sizes where the
+ * map does not fit in memory. Average time per lookup.
+ *
+ *   g++ -std=c++98 -O2 -I. bench/eytzinger_set.cpp -o eytzinger_set
+ *   ./eytzinger_set [n [nomap]]
+ */
+
+#include "ft/eytzinger_set.hpp"
+#include "ft/map.hpp"
+#include "bench/bench.hpp"
+#include <algorithm>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int const	lookups = 2000000;
+
+int main(int argc, char **argv)
+{
+	size_t				n = argc > 1 ? atol(argv[1]) : 1 << 20;
+	bool				with_map = argc < 3 || strcmp(argv[2], "nomap");
+	ft::vector<int>		sorted;
+	std::vector<int>	queries(lookups);
+	bench_random		random;
+	long				sum = 0;
+	double				start;
+
+	sorted.reserve(n);
+	for (size_t i = 0; i < n; ++i)
+		sorted.push_back(2 * i);
+	for (int i = 0; i < lookups; ++i)
+		queries[i] = random() % (2 * n);
+
+	start = bench_now();
+	for (int i = 0; i < lookups; ++i)
+		sum += std::lower_bound(sorted.begin(), sorted.end(), queries[i]) - sorted.begin();
+	printf("sorted vector   %5.0f ns\n", (bench_now() - start) / lookups * 1e9);
+
+	ft::eytzinger_set<int> set(sorted);
+
+	start = bench_now();
+	for (int i = 0; i < lookups; ++i)
+		sum -= set.rank(queries[i]);
+	printf("eytzinger_set   %5.0f ns\n", (bench_now() - start) / lookups * 1e9);
+	/* both give the position of the lower bound */
+	if (sum) {
+		fprintf(stderr, "eytzinger_set and the sorted vector disagree\n");
+		return 1;
+	}
+
+	if (with_map) {
+		ft::map<int, int> map;
+
+		for (size_t i = 0; i < n; ++i)
+			map.insert(map.end(), ft::make_pair(sorted[i], 0));
+		start = bench_now();
+		for (int i = 0; i < lookups; ++i)
+			sum += map.lower_bound(queries[i]) != map.end();
+		printf("ft::map         %5.0f ns\n", (bench_now() - start) / lookups * 1e9);
+	}
+	bench_keep(sum);
+	return 0;
+}
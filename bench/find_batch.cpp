@@ -0,0 +1,120 @@
+/* find_batch.cpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ *
+ * 2M lookups of random long keys, half of them present, in a map<long,
+ * long> of 64K to 16M elements: a loop of find against find_batch and
+ * lower_bound_batch, with the keys in random order, then sorted. Best
+ * of 3. Then the comparisons per lookup of each, counted by
+ * operation_trace on a copy of the map.
+ *
+ *   g++ -std=c++98 -O2 -I. bench/find_batch.cpp -o find_batch
+ *   ./find_batch [largest size]
+ *
+ * A node of this map is 64 bytes, so from 1M elements on the tree is
+ * far larger than the last-level cache of a usual machine.
+ */
+
+#include "ft/map.hpp"
+#include "bench/bench.hpp"
+#include <algorithm>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef ft::map<long, long>	long_map;
+typedef ft::map<long, long, ft::less<long>, std::allocator<ft::pair<long const, long> >,
+	ft::no_order_statistics, ft::operation_trace>	traced_map;
+
+static size_t const	lookups = 2000000;
+static int const	rounds = 3;
+
+static double loop_find(long_map const &map, std::vector<long> const &keys)
+{
+	double	start = bench_now();
+	long	found = 0;
+
+	for (size_t i = 0; i < keys.size(); ++i)
+		found += map.find(keys[i]) != map.end();
+	bench_keep(found);
+	return bench_now() - start;
+}
+
+static double batch(long_map const &map, std::vector<long> const &keys, bool exact,
+	std::vector<long_map::const_iterator> &out)
+{
+	double start = bench_now();
+
+	out.clear();
+	if (exact)
+		map.find_batch(keys.begin(), keys.end(), std::back_inserter(out));
+	else
+		map.lower_bound_batch(keys.begin(), keys.end(), std::back_inserter(out));
+	bench_keep(out[out.size() / 2]);
+	return bench_now() - start;
+}
+
+/* The comparisons per lookup of each way, on a traced copy of map. */
+static void trace(long_map const &map, std::vector<long> const &keys)
+{
+	traced_map								copy(map.begin(), map.end());
+	std::vector<traced_map::const_iterator>	found;
+	ft::trace_counts						t;
+
+	found.reserve(keys.size());
+	t = ft::operation_trace::global();
+	for (size_t i = 0; i < keys.size(); ++i)
+		found.push_back(copy.find(keys[i]));
+	t = bench_trace("  find", t, keys.size());
+	found.clear();
+	copy.find_batch(keys.begin(), keys.end(), std::back_inserter(found));
+	t = bench_trace("  find_batch", t, keys.size());
+	found.clear();
+	copy.lower_bound_batch(keys.begin(), keys.end(), std::back_inserter(found));
+	bench_trace("  lower_bound_batch", t, keys.size());
+}
+
+static void run(size_t size, bench_random &random)
+{
+	long_map								map;
+	std::vector<long>						keys(lookups);
+	std::vector<long_map::const_iterator>	out;
+	std::vector<long>						even(size);
+
+	/* the even numbers below 2 * size in random order, so that half of
+	 * the keys looked up are there */
+	for (size_t i = 0; i < size; ++i)
+		even[i] = 2 * i;
+	for (size_t i = size - 1; i > 0; --i)
+		std::swap(even[i], even[random() % (i + 1)]);
+	for (size_t i = 0; i < size; ++i)
+		map.insert(ft::make_pair(even[i], 0L));
+	out.reserve(lookups);
+	for (size_t i = 0; i < lookups; ++i)
+		keys[i] = random() % (2 * size);
+
+	for (int sorted = 0; sorted < 2; ++sorted) {
+		double best[3] = { 1e9, 1e9, 1e9 };
+
+		if (sorted)
+			std::sort(keys.begin(), keys.end());
+		for (int r = 0; r < rounds; ++r) {
+			best[0] = std::min(best[0], loop_find(map, keys));
+			best[1] = std::min(best[1], batch(map, keys, true, out));
+			best[2] = std::min(best[2], batch(map, keys, false, out));
+		}
+		printf("%9zu elements, %s keys: find %.3f s, find_batch %.3f s, lower_bound_batch %.3f s\n",
+			map.size(), sorted ? "sorted" : "random", best[0], best[1], best[2]);
+	}
+	trace(map, keys);
+}
+
+int main(int argc, char **argv)
+{
+	size_t			largest = argc > 1 ? strtoul(argv[1], 0, 10) : 1 << 24;
+	bench_random	random;
+
+	for (size_t size = 1 << 16; size <= largest; size *= 4)
+		run(size, random);
+	return 0;
+}
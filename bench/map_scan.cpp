@@ -0,0 +1,59 @@
+/* map_scan.cpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ *
+ * Full in-order scan of a 10M-entry map<int, int> filled in random
+ * order, forward and backward, for ft::map and std::map. Best of 3.
+ *
+ *   g++ -std=c++98 -O2 -I. bench/map_scan.cpp -o map_scan
+ */
+
+#include "ft/map.hpp"
+#include "bench/bench.hpp"
+#include <map>
+#include <vector>
+#include <stdio.h>
+
+static int const	size = 10000000;
+static int const	rounds = 3;
+
+template <class Iterator>
+static double scan(Iterator first, Iterator last)
+{
+	double	start = bench_now();
+	long	sum = 0;
+
+	for (; first != last; ++first)
+		sum += first->second;
+	bench_keep(sum);
+	return bench_now() - start;
+}
+
+int main(void)
+{
+	std::vector<int>	keys(size);
+	bench_random		random;
+	ft::map<int, int>	ft_map;
+	std::map<int, int>	std_map;
+
+	for (int i = 0; i < size; ++i)
+		keys[i] = i;
+	for (int i = size - 1; i > 0; --i)
+		std::swap(keys[i], keys[random() % (i + 1)]);
+	for (int i = 0; i < size; ++i) {
+		ft_map.insert(ft::make_pair(keys[i], i));
+		std_map.insert(std::make_pair(keys[i], i));
+	}
+
+	double best[3] = { 1e9, 1e9, 1e9 };
+
+	for (int r = 0; r < rounds; ++r) {
+		best[0] = std::min(best[0], scan(ft_map.begin(), ft_map.end()));
+		best[1] = std::min(best[1], scan(ft_map.rbegin(), ft_map.rend()));
+		best[2] = std::min(best[2], scan(std_map.begin(), std_map.end()));
+	}
+	printf("ft::map forward   %.3f s\n", best[0]);
+	printf("ft::map reverse   %.3f s\n", best[1]);
+	printf("std::map forward  %.3f s\n", best[2]);
+	return 0;
+}
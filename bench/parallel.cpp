@@ -0,0 +1,97 @@
+/* parallel.cpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ *
+ * Time of parallel_for_each and parallel_reduce over 100M doubles, and of
+ * parallel_for_each over a map of 2M elements, with pools of 0, 1, 3 and
+ * 15 workers, against the same loops run sequentially.
+ *
+ *   g++ -std=c++98 -O2 -I. bench/parallel.cpp -o parallel -lpthread
+ *   ./parallel [elements]
+ *
+ * The calling thread runs tasks too, so a pool of 0 workers measures the
+ * cost of splitting the range alone.
+ */
+
+#include "ft/algorithm.hpp"
+#include "ft/map.hpp"
+#include "bench/bench.hpp"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static size_t const	workers[] = { 0, 1, 3, 15 };
+static int const	map_elements = 2000000;
+
+struct step
+{
+	void operator()(double &x) const { x = sqrt(x) * 1.0001 + 1; }
+
+	void operator()(ft::pair<int const, double> &p) const { (*this)(p.second); }
+};
+
+struct add
+{
+	double operator()(double a, double b) const { return a + b; }
+};
+
+static void bench_vector(size_t n)
+{
+	ft::vector<double>	v(n, 4.0);
+	double				start = bench_now();
+	double				sum = 0;
+	step				f;
+
+	for (size_t i = 0; i < n; ++i)
+		f(v[i]);
+	printf("%zu doubles, sequential:        for_each %.3f s", n, bench_now() - start);
+	start = bench_now();
+	for (size_t i = 0; i < n; ++i)
+		sum += v[i];
+	printf(", sum %.3f s\n", bench_now() - start);
+	bench_keep(sum);
+
+	for (size_t k = 0; k < sizeof(workers) / sizeof(*workers); ++k) {
+		ft::thread_pool	pool(workers[k]);
+
+		start = bench_now();
+		ft::parallel_for_each(v.begin(), v.end(), step(), ft::parallel_grain, pool);
+		printf("%zu doubles, pool of %2zu workers: for_each %.3f s", n, workers[k], bench_now() - start);
+		start = bench_now();
+		sum = ft::parallel_reduce(v.begin(), v.end(), 0.0, add(), ft::parallel_grain, pool);
+		printf(", reduce %.3f s\n", bench_now() - start);
+		bench_keep(sum);
+	}
+}
+
+static void bench_map(void)
+{
+	typedef ft::map<int, double>	map_type;
+
+	map_type	m;
+	double		start;
+	step		f;
+
+	for (int i = 0; i < map_elements; ++i)
+		m.insert(map_type::value_type(i, 4.0));
+	start = bench_now();
+	for (map_type::iterator it = m.begin(); it != m.end(); ++it)
+		f(*it);
+	printf("%d-element map, sequential:        for_each %.3f s\n", map_elements, bench_now() - start);
+
+	for (size_t k = 0; k < sizeof(workers) / sizeof(*workers); ++k) {
+		ft::thread_pool	pool(workers[k]);
+
+		start = bench_now();
+		ft::parallel_for_each(m.begin(), m.end(), step(), ft::parallel_grain, pool);
+		printf("%d-element map, pool of %2zu workers: for_each %.3f s\n", map_elements, workers[k],
+			bench_now() - start);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	bench_vector(argc > 1 ? strtoul(argv[1], 0, 10) : 100000000);
+	bench_map();
+	return 0;
+}
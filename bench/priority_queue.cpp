@@ -0,0 +1,68 @@
+/* priority_queue.cpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ *
+ * Binary and 4-ary ft::priority_queue against std::priority_queue over
+ * random ints: n pushes, then n pop+push, then a full drain. n defaults
+ * to 4M. Each line is the best of 3 runs, in seconds.
+ *
+ *   g++ -std=c++98 -O2 -I. bench/priority_queue.cpp -o priority_queue
+ *   ./priority_queue [n]
+ */
+
+#include "ft/priority_queue.hpp"
+#include "bench/bench.hpp"
+#include <algorithm>
+#include <queue>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+
+static int const	rounds = 3;
+
+template <class Queue>
+static void run(char const *name, std::vector<int> const &keys, size_t n)
+{
+	double best[3] = { 1e9, 1e9, 1e9 };
+
+	for (int r = 0; r < rounds; ++r) {
+		Queue	queue;
+		long	sum = 0;
+		double	start = bench_now();
+
+		for (size_t i = 0; i < n; ++i)
+			queue.push(keys[i]);
+		best[0] = std::min(best[0], bench_now() - start);
+
+		start = bench_now();
+		for (size_t i = 0; i < n; ++i) {
+			sum += queue.top();
+			queue.pop();
+			queue.push(keys[n + i]);
+		}
+		best[1] = std::min(best[1], bench_now() - start);
+
+		start = bench_now();
+		while (!queue.empty()) {
+			sum += queue.top();
+			queue.pop();
+		}
+		best[2] = std::min(best[2], bench_now() - start);
+		bench_keep(sum);
+	}
+	printf("%-22s push %.3f  mixed %.3f  drain %.3f\n", name, best[0], best[1], best[2]);
+}
+
+int main(int argc, char **argv)
+{
+	size_t				n = argc > 1 ? atol(argv[1]) : 4000000;
+	std::vector<int>	keys(n * 2);
+	bench_random		random;
+
+	for (size_t i = 0; i < keys.size(); ++i)
+		keys[i] = random() >> 33;
+	run<ft::priority_queue<int, ft::vector<int>, ft::less<int>, 2> >("ft::priority_queue D=2", keys, n);
+	run<ft::priority_queue<int, ft::vector<int>, ft::less<int>, 4> >("ft::priority_queue D=4", keys, n);
+	run<std::priority_queue<int> >("std::priority_queue", keys, n);
+	return 0;
+}
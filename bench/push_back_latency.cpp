@@ -0,0 +1,59 @@
+/* push_back_latency.cpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ *
+ * Times every push_back while ft::vector and ft::incremental_vector grow
+ * to 2^25 ints, and prints the latency percentiles and histogram of each,
+ * then the copies and allocations per push_back of ft::vector.
+ *
+ *   g++ -std=c++98 -O2 -I. bench/push_back_latency.cpp -o push_back_latency
+ *
+ * The timer itself costs some 20 ns, so the low percentiles mostly
+ * measure it; the tail is what this is about. Freeing a buffer of tens
+ * of megabytes takes milliseconds in the kernel, and both vectors pay
+ * that once per growth: for incremental_vector it is most of the max.
+ */
+
+#include "ft/vector.hpp"
+#include "ft/incremental_vector.hpp"
+#include "bench/bench.hpp"
+#include <stdio.h>
+
+static int const	pushes = 1 << 25;
+
+template <class Vector>
+static void run(char const *name)
+{
+	latency_histogram	*h = new latency_histogram;
+	Vector				vct;
+
+	for (int i = 0; i < pushes; ++i) {
+		uint64_t start = bench_ns();
+
+		vct.push_back(i);
+		h->add(bench_ns() - start);
+	}
+	bench_keep(vct[pushes / 2]);
+	bench_report(name, *h);
+	delete h;
+}
+
+/* The copies and allocations behind the latencies of ft::vector. */
+static void trace(void)
+{
+	ft::vector<int, std::allocator<int>, ft::operation_trace>	vct;
+	ft::trace_counts											t = ft::operation_trace::global();
+
+	for (int i = 0; i < pushes; ++i)
+		vct.push_back(i);
+	bench_keep(vct[pushes / 2]);
+	bench_trace("ft::vector push_back", t, pushes);
+}
+
+int main(void)
+{
+	run<ft::vector<int> >("ft::vector");
+	run<ft::incremental_vector<int> >("ft::incremental_vector");
+	trace();
+	return 0;
+}
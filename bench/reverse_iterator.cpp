@@ -0,0 +1,80 @@
+/* reverse_iterator.cpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ *
+ * Sums an ft::vector<int> back to front through rbegin()..rend() and
+ * through a raw pointer, with std::vector for reference.
+ *
+ *   g++ -std=c++98 -O3 -I. bench/reverse_iterator.cpp -o reverse_iterator
+ *
+ * Adding -S instead of -o shows that the ft loop is vectorized like the
+ * pointer loop.
+ */
+
+#include "ft/vector.hpp"
+#include "bench/bench.hpp"
+#include <vector>
+#include <stdio.h>
+
+static int const	size = 1 << 16;
+static int const	rounds = 20000;
+
+__attribute__((noinline)) int sum_ft(ft::vector<int> const &v)
+{
+	int s = 0;
+
+	for (ft::vector<int>::const_reverse_iterator it = v.rbegin(); it != v.rend(); ++it)
+		s += *it;
+	return s;
+}
+
+__attribute__((noinline)) int sum_pointer(int const *first, int const *last)
+{
+	int s = 0;
+
+	while (last != first)
+		s += *--last;
+	return s;
+}
+
+__attribute__((noinline)) int sum_std(std::vector<int> const &v)
+{
+	int s = 0;
+
+	for (std::vector<int>::const_reverse_iterator it = v.rbegin(); it != v.rend(); ++it)
+		s += *it;
+	return s;
+}
+
+static void report(char const *name, double start)
+{
+	printf("%-22s %.3f ns/element\n", name, (bench_now() - start) * 1e9 / ((double)size * rounds));
+}
+
+int main(void)
+{
+	ft::vector<int>		ft_vct;
+	std::vector<int>	std_vct;
+	double				start;
+
+	for (int i = 0; i < size; ++i) {
+		ft_vct.push_back(i);
+		std_vct.push_back(i);
+	}
+
+	start = bench_now();
+	for (int r = 0; r < rounds; ++r)
+		bench_keep(sum_pointer(ft_vct.data(), ft_vct.data() + size));
+	report("pointer", start);
+
+	start = bench_now();
+	for (int r = 0; r < rounds; ++r)
+		bench_keep(sum_ft(ft_vct));
+	report("ft::reverse_iterator", start);
+
+	start = bench_now();
+	for (int r = 0; r < rounds; ++r)
+		bench_keep(sum_std(std_vct));
+	report("std::reverse_iterator", start);
+	return 0;
+}
@@ -8,5 +8,6 @@
 
 # include "equal.hpp"
 # include "lexicographical_compare.hpp"
+# include "parallel.hpp"
 
 #endif /* __ALGORITHM_HPP__ */
@@ -0,0 +1,397 @@
+/* bounded_queue.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __BOUNDED_QUEUE_HPP__
+# define __BOUNDED_QUEUE_HPP__
+
+# include "type_traits.hpp"
+# include <memory>
+# include <new>
+# include <stddef.h>
+# include <assert.h>
+
+namespace ft
+{
+
+/* Size of the padding that keeps the indices written by different
+ * threads on different cache lines. A whole line of it goes between two
+ * groups of indices, so that they never share one wherever the queue
+ * starts: operator new only aligns it to 16 bytes.
+ */
+enum { cache_line_size = 64 };
+
+/* Smallest power of two that is not less than n. */
+inline size_t bounded_queue_capacity(size_t n)
+{
+	size_t c = 1;
+
+	while (c < n)
+		c <<= 1;
+	return c;
+}
+
+/*------------------------------------------------------------*/
+/*--- Single producer, single consumer                     ---*/
+/*------------------------------------------------------------*/
+
+/* Lock-free bounded queue for exactly one producer thread and one
+ * consumer thread. The capacity is rounded up to a power of two.
+ *
+ * The producer owns _tail and the consumer owns _head, each on its own
+ * cache line. Each side also keeps a copy of the other side's index and
+ * only reloads it when the queue looks full (or empty), so most pushes
+ * and pops touch no shared cache line but the slot itself. push_n and
+ * pop_n publish a whole batch with a single store.
+ */
+template <typename T, typename Allocator = std::allocator<T> >
+class spsc_queue
+{
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef T					value_type;
+		typedef Allocator			allocator_type;
+		typedef size_t				size_type;
+
+	private:
+		allocator_type	_allocator;
+		T				*_slots;
+		size_type		_mask;
+		char			_pad0[cache_line_size];
+
+		/* written by the producer */
+		size_type		_tail;
+		size_type		_head_cache;
+		char			_pad1[cache_line_size];
+
+		/* written by the consumer */
+		size_type		_head;
+		size_type		_tail_cache;
+		char			_pad2[cache_line_size];
+
+		spsc_queue(spsc_queue const &);
+		spsc_queue &operator=(spsc_queue const &);
+
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Construct/destroy                                    ---*/
+	/*------------------------------------------------------------*/
+
+		/* Constructs an empty queue with room for at least n elements. */
+		explicit spsc_queue(size_type n, allocator_type const &alloc = allocator_type())
+			: _allocator(alloc)
+			, _slots(0)
+			, _mask(bounded_queue_capacity(n) - 1)
+			, _tail(0)
+			, _head_cache(0)
+			, _head(0)
+			, _tail_cache(0)
+		{ _slots = _allocator.allocate(_mask + 1); }
+
+		/* Destroys the elements left in the queue. No thread may be
+		 * using it anymore.
+		 */
+		~spsc_queue(void)
+		{
+			for (; _head != _tail; ++_head)
+				_allocator.destroy(_slots + (_head & _mask));
+			_allocator.deallocate(_slots, _mask + 1);
+		}
+
+	/*------------------------------------------------------------*/
+	/*--- Capacity                                             ---*/
+	/*------------------------------------------------------------*/
+
+		size_type capacity(void) const { return _mask + 1; }
+
+		/* Number of elements at the time of the call, which may already
+		 * be stale when another thread is using the queue.
+		 */
+		size_type size(void) const
+		{
+			return __atomic_load_n(&_tail, __ATOMIC_ACQUIRE)
+				- __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+		}
+
+		bool empty(void) const { return size() == 0; }
+
+	/*------------------------------------------------------------*/
+	/*--- Producer                                             ---*/
+	/*------------------------------------------------------------*/
+
+		/* Appends a copy of x. Returns false if the queue is full. */
+		bool push(value_type const &x)
+		{
+			size_type tail = _tail;
+
+			if (tail - _head_cache > _mask) {
+				_head_cache = __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+				if (tail - _head_cache > _mask)
+					return false;
+			}
+			_allocator.construct(_slots + (tail & _mask), x);
+			__atomic_store_n(&_tail, tail + 1, __ATOMIC_RELEASE);
+			return true;
+		}
+
+		/* Appends copies of as many of the n elements starting at first
+		 * as there is room for. Returns how many were pushed.
+		 */
+		template <class InputIterator>
+		size_type push_n(InputIterator first, size_type n)
+		{
+			size_type tail = _tail;
+			size_type room = _mask + 1 - (tail - _head_cache);
+
+			if (room < n) {
+				_head_cache = __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+				room = _mask + 1 - (tail - _head_cache);
+			}
+			if (n > room)
+				n = room;
+			for (size_type i = 0; i < n; ++i, ++first)
+				_allocator.construct(_slots + ((tail + i) & _mask), *first);
+			__atomic_store_n(&_tail, tail + n, __ATOMIC_RELEASE);
+			return n;
+		}
+
+	/*------------------------------------------------------------*/
+	/*--- Consumer                                             ---*/
+	/*------------------------------------------------------------*/
+
+		/* Moves the oldest element into x. Returns false if the queue
+		 * is empty.
+		 */
+		bool pop(value_type &x)
+		{
+			size_type head = _head;
+
+			if (head == _tail_cache) {
+				_tail_cache = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+				if (head == _tail_cache)
+					return false;
+			}
+
+			T *slot = _slots + (head & _mask);
+
+			x = *slot;
+			_allocator.destroy(slot);
+			__atomic_store_n(&_head, head + 1, __ATOMIC_RELEASE);
+			return true;
+		}
+
+		/* Moves up to n of the oldest elements to out. Returns how many
+		 * were popped.
+		 */
+		template <class OutputIterator>
+		size_type pop_n(OutputIterator out, size_type n)
+		{
+			size_type head = _head;
+
+			if (_tail_cache - head < n)
+				_tail_cache = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+			if (n > _tail_cache - head)
+				n = _tail_cache - head;
+			for (size_type i = 0; i < n; ++i, ++out) {
+				T *slot = _slots + ((head + i) & _mask);
+
+				*out = *slot;
+				_allocator.destroy(slot);
+			}
+			__atomic_store_n(&_head, head + n, __ATOMIC_RELEASE);
+			return n;
+		}
+};
+
+/*------------------------------------------------------------*/
+/*--- Multiple producers, multiple consumers               ---*/
+/*------------------------------------------------------------*/
+
+/* Lock-free bounded queue for any number of producer and consumer
+ * threads. The capacity is rounded up to a power of two.
+ *
+ * Every slot carries a sequence number that tells which turn it is on:
+ * slot i is free for the push at position p when its sequence is p, and
+ * holds the element for the pop at position p when it is p + 1. A thread
+ * claims a position with a compare-and-swap on the shared index, then
+ * works on the slot without further contention. push_n and pop_n claim a
+ * run of ready slots with a single compare-and-swap.
+ */
+template <typename T, typename Allocator = std::allocator<T> >
+class mpmc_queue
+{
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef T					value_type;
+		typedef Allocator			allocator_type;
+		typedef size_t				size_type;
+
+	private:
+		struct slot
+		{
+			size_type																sequence;
+			typename aligned_storage<sizeof(T), alignment_of<T>::value>::type	storage;
+
+			T *value(void) { return reinterpret_cast<T *>(storage.data); }
+		};
+
+		typedef typename Allocator::template rebind<slot>::other	slot_allocator;
+
+		allocator_type	_allocator;
+		slot_allocator	_slot_allocator;
+		slot			*_slots;
+		size_type		_mask;
+		char			_pad0[cache_line_size];
+
+		size_type		_tail;
+		char			_pad1[cache_line_size];
+
+		size_type		_head;
+		char			_pad2[cache_line_size];
+
+		mpmc_queue(mpmc_queue const &);
+		mpmc_queue &operator=(mpmc_queue const &);
+
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Construct/destroy                                    ---*/
+	/*------------------------------------------------------------*/
+
+		/* Constructs an empty queue with room for at least n elements. */
+		explicit mpmc_queue(size_type n, allocator_type const &alloc = allocator_type())
+			: _allocator(alloc)
+			, _slot_allocator(alloc)
+			, _slots(0)
+			, _mask(bounded_queue_capacity(n) - 1)
+			, _tail(0)
+			, _head(0)
+		{
+			_slots = _slot_allocator.allocate(_mask + 1);
+			for (size_type i = 0; i <= _mask; ++i)
+				_slots[i].sequence = i;
+		}
+
+		/* Destroys the elements left in the queue. No thread may be
+		 * using it anymore.
+		 */
+		~mpmc_queue(void)
+		{
+			for (; _head != _tail; ++_head)
+				_allocator.destroy(_slots[_head & _mask].value());
+			_slot_allocator.deallocate(_slots, _mask + 1);
+		}
+
+	/*------------------------------------------------------------*/
+	/*--- Capacity                                             ---*/
+	/*------------------------------------------------------------*/
+
+		size_type capacity(void) const { return _mask + 1; }
+
+		/* Number of claimed positions at the time of the call, which may
+		 * already be stale when other threads are using the queue.
+		 */
+		size_type size(void) const
+		{
+			size_type head = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+			size_type tail = __atomic_load_n(&_tail, __ATOMIC_RELAXED);
+
+			return tail - head <= _mask + 1 ? tail - head : 0;
+		}
+
+		bool empty(void) const { return size() == 0; }
+
+	/*------------------------------------------------------------*/
+	/*--- Modifiers                                            ---*/
+	/*------------------------------------------------------------*/
+
+		/* Appends a copy of x. Returns false if the queue is full. */
+		bool push(value_type const &x) { return push_n(&x, 1) == 1; }
+
+		/* Appends copies of up to n elements starting at first, as many
+		 * as there are free slots in a row. Returns how many were pushed.
+		 */
+		template <class InputIterator>
+		size_type push_n(InputIterator first, size_type n)
+		{
+			size_type tail = _claim(_tail, 0, n);
+
+			for (size_type i = 0; i < n; ++i, ++first) {
+				slot *s = _slots + ((tail + i) & _mask);
+
+				_allocator.construct(s->value(), *first);
+				__atomic_store_n(&s->sequence, tail + i + 1, __ATOMIC_RELEASE);
+			}
+			return n;
+		}
+
+		/* Moves the oldest element into x. Returns false if the queue
+		 * is empty.
+		 */
+		bool pop(value_type &x) { return pop_n(&x, 1) == 1; }
+
+		/* Moves up to n of the oldest elements to out, as many as are
+		 * ready in a row. Returns how many were popped.
+		 */
+		template <class OutputIterator>
+		size_type pop_n(OutputIterator out, size_type n)
+		{
+			size_type head = _claim(_head, 1, n);
+
+			for (size_type i = 0; i < n; ++i, ++out) {
+				slot *s = _slots + ((head + i) & _mask);
+
+				*out = *s->value();
+				_allocator.destroy(s->value());
+				__atomic_store_n(&s->sequence, head + i + _mask + 1, __ATOMIC_RELEASE);
+			}
+			return n;
+		}
+
+	private:
+		/* Claims up to n positions in a row from index, whose slots must
+		 * have a sequence equal to their position plus offset. Stores the
+		 * number of positions claimed in n and returns the first one.
+		 */
+		size_type _claim(size_type &index, size_type offset, size_type &n)
+		{
+			size_type pos = __atomic_load_n(&index, __ATOMIC_RELAXED);
+
+			while (n) {
+				size_type	ready = 0;
+				ptrdiff_t	diff = 0;
+
+				for (; ready < n; ++ready) {
+					slot *s = _slots + ((pos + ready) & _mask);
+
+					diff = static_cast<ptrdiff_t>(
+						__atomic_load_n(&s->sequence, __ATOMIC_ACQUIRE) - (pos + ready + offset));
+					if (diff)
+						break;
+				}
+				if (ready) {
+					if (__atomic_compare_exchange_n(&index, &pos, pos + ready, true,
+							__ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+						n = ready;
+						break;
+					}
+				} else if (diff < 0)
+					/* the slot is a lap behind: the queue is full (or empty) */
+					n = 0;
+				else
+					/* another thread took pos */
+					pos = __atomic_load_n(&index, __ATOMIC_RELAXED);
+			}
+			return pos;
+		}
+};
+
+} /* namespace: ft */
+
+#endif /* __BOUNDED_QUEUE_HPP__ */
@@ -0,0 +1,319 @@
+/* caching_allocator.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __CACHING_ALLOCATOR_HPP__
+# define __CACHING_ALLOCATOR_HPP__
+
+# include <new>
+# include <stddef.h>
+# include <assert.h>
+# include <pthread.h>
+
+namespace ft
+{
+
+/*------------------------------------------------------------*/
+/*--- Node cache                                           ---*/
+/*------------------------------------------------------------*/
+
+/* Sizes of the node cache, in blocks. A thread moves blocks to and from
+ * the depot a batch at a time, and keeps at most two batches.
+ */
+enum
+{
+	node_cache_batch = 32,
+	node_cache_chunk = 16 * node_cache_batch
+};
+
+/* Block size class of objects of Size bytes: a multiple of two pointers,
+ * the alignment of operator new, and room for the links of a free block.
+ */
+template <size_t Size>
+struct node_cache_size
+{
+	enum
+	{
+		unit = 2 * sizeof(void *),
+		value = (Size + unit - 1) / unit * unit
+	};
+};
+
+/* Free blocks of Size bytes shared by all the threads.
+ *
+ * Every thread keeps a list of free blocks of its own and allocates and
+ * frees with no lock. When the list is empty, the thread takes a batch of
+ * blocks from the depot; when it holds two batches, it gives one back.
+ * A block does not belong to the thread that allocated it: a block freed
+ * by another thread joins that thread's list, and goes back through the
+ * depot to wherever blocks run short. The lists of a thread are given
+ * back to the depot when it exits.
+ *
+ * The depot takes new blocks from chunks of operator new, which are kept
+ * until the program exits.
+ */
+template <size_t Size>
+class node_cache
+{
+	private:
+		struct block
+		{
+			block	*next;
+			block	*next_batch;	/* set on the first block of a batch in the depot */
+		};
+
+		/* the free list of a thread */
+		struct thread_cache
+		{
+			block	*head;
+			size_t	count;
+			bool	registered;	/* for _thread_exit, on the first allocation or free */
+		};
+
+		struct chunk
+		{
+			chunk	*next;
+		};
+
+		enum { block_size = Size < sizeof(block) ? sizeof(block) : Size };
+
+		static __thread thread_cache	_cache;
+
+		static pthread_once_t			_once;
+		static pthread_key_t			_key;
+		static pthread_mutex_t			_lock;
+		static block					*_batches;	/* full batches, under _lock */
+		static chunk					*_chunks;	/* every chunk, under _lock */
+		static char						*_carve;	/* unused part of the last chunk */
+		static char						*_carve_end;
+
+	public:
+		static void *allocate(void)
+		{
+			thread_cache &c = _cache;
+
+			if (!c.head)
+				_refill(c);
+
+			block *b = c.head;
+
+			c.head = b->next;
+			--c.count;
+			return b;
+		}
+
+		static void deallocate(void *p)
+		{
+			thread_cache	&c = _cache;
+			block			*b = static_cast<block *>(p);
+
+			b->next = c.head;
+			c.head = b;
+			if (!c.registered)
+				_register(c);
+			if (++c.count >= 2 * node_cache_batch)
+				_release(c, node_cache_batch);
+		}
+
+	private:
+		/* Fills the empty list of the thread with a batch from the depot,
+		 * or with new blocks. Batches from the depot are counted, as those
+		 * of exited threads can be of any length.
+		 */
+		static void _refill(thread_cache &c)
+		{
+			bool carved = false;
+
+			_register(c);
+			pthread_mutex_lock(&_lock);
+			if (_batches) {
+				c.head = _batches;
+				_batches = _batches->next_batch;
+			} else {
+				c.head = _carve_batch();
+				carved = true;
+			}
+			pthread_mutex_unlock(&_lock);
+			if (!c.head)
+				throw std::bad_alloc();
+			if (carved)
+				c.count = node_cache_batch;
+			else {
+				c.count = 0;
+				for (block *b = c.head; b; b = b->next)
+					++c.count;
+			}
+		}
+
+		/* Carves a batch of blocks out of the last chunk, taking a new one
+		 * if it is used up. Returns 0 if there is no memory left. Called
+		 * with _lock held.
+		 */
+		static block *_carve_batch(void)
+		{
+			size_t const batch_bytes = node_cache_batch * block_size;
+
+			if (_carve == _carve_end) {
+				size_t	header = node_cache_size<sizeof(chunk)>::value;
+				char	*raw = static_cast<char *>(
+					::operator new(header + node_cache_chunk * block_size, std::nothrow));
+
+				if (!raw)
+					return 0;
+				reinterpret_cast<chunk *>(raw)->next = _chunks;
+				_chunks = reinterpret_cast<chunk *>(raw);
+				_carve = raw + header;
+				_carve_end = _carve + node_cache_chunk * block_size;
+			}
+
+			char *first = _carve;
+
+			_carve += batch_bytes;
+			for (size_t i = 0; i + 1 < node_cache_batch; ++i)
+				reinterpret_cast<block *>(first + i * block_size)->next
+					= reinterpret_cast<block *>(first + (i + 1) * block_size);
+			reinterpret_cast<block *>(first + batch_bytes - block_size)->next = 0;
+			return reinterpret_cast<block *>(first);
+		}
+
+		/* Gives n blocks from the head of the list of the thread back to
+		 * the depot, as one batch, or the whole list if it is shorter.
+		 */
+		static void _release(thread_cache &c, size_t n)
+		{
+			assert(n && n <= c.count && c.head);
+
+			block	*first = c.head;
+			block	*last = first;
+			size_t	i = 1;
+
+			for (; i < n && last->next; ++i)
+				last = last->next;
+			c.head = last->next;
+			c.count = c.head ? c.count - i : 0;
+			last->next = 0;
+			_register(c);
+			pthread_mutex_lock(&_lock);
+			first->next_batch = _batches;
+			_batches = first;
+			pthread_mutex_unlock(&_lock);
+		}
+
+		/* Makes the thread give its list back when it exits. */
+		static void _register(thread_cache &c)
+		{
+			if (c.registered)
+				return ;
+			pthread_once(&_once, _make_key);
+			pthread_setspecific(_key, &c);
+			c.registered = true;
+		}
+
+		static void _make_key(void) { pthread_key_create(&_key, _thread_exit); }
+
+		/* Gives the list of an exiting thread back to the depot, as one
+		 * batch of up to twice the usual length, or shorter. _refill
+		 * counts the blocks of the batch when a thread takes it.
+		 */
+		static void _thread_exit(void *p)
+		{
+			thread_cache &c = *static_cast<thread_cache *>(p);
+
+			if (c.count)
+				_release(c, c.count);
+		}
+};
+
+template <size_t Size>
+__thread typename node_cache<Size>::thread_cache node_cache<Size>::_cache = { 0, 0, false };
+
+template <size_t Size>
+pthread_once_t node_cache<Size>::_once = PTHREAD_ONCE_INIT;
+
+template <size_t Size>
+pthread_key_t node_cache<Size>::_key;
+
+template <size_t Size>
+pthread_mutex_t node_cache<Size>::_lock = PTHREAD_MUTEX_INITIALIZER;
+
+template <size_t Size>
+typename node_cache<Size>::block *node_cache<Size>::_batches = 0;
+
+template <size_t Size>
+typename node_cache<Size>::chunk *node_cache<Size>::_chunks = 0;
+
+template <size_t Size>
+char *node_cache<Size>::_carve = 0;
+
+template <size_t Size>
+char *node_cache<Size>::_carve_end = 0;
+
+/*------------------------------------------------------------*/
+/*--- Caching allocator                                    ---*/
+/*------------------------------------------------------------*/
+
+/* Stateless allocator that takes single objects from the node_cache of
+ * their size class, for containers that allocate one node at a time such
+ * as ft::map. Nodes can be freed on any thread. Arrays of more than one
+ * object go to operator new.
+ */
+template <class T>
+class caching_allocator
+{
+	public:
+		typedef T				value_type;
+		typedef T				*pointer;
+		typedef T const			*const_pointer;
+		typedef T				&reference;
+		typedef T const			&const_reference;
+		typedef size_t			size_type;
+		typedef ptrdiff_t		difference_type;
+
+		template <class U>
+		struct rebind { typedef caching_allocator<U> other; };
+
+	private:
+		typedef node_cache<node_cache_size<sizeof(T)>::value>	cache;
+
+	public:
+		caching_allocator(void) { }
+		caching_allocator(caching_allocator const &) { }
+		template <class U>
+		caching_allocator(caching_allocator<U> const &) { }
+
+		pointer			address(reference x) const			{ return &x; }
+		const_pointer	address(const_reference x) const	{ return &x; }
+
+		size_type max_size(void) const { return size_type(-1) / sizeof(T); }
+
+		pointer allocate(size_type n, void const * = 0)
+		{
+			if (n == 1)
+				return static_cast<pointer>(cache::allocate());
+			if (n > max_size())
+				throw std::bad_alloc();
+			return static_cast<pointer>(::operator new(n * sizeof(T)));
+		}
+
+		void deallocate(pointer p, size_type n)
+		{
+			if (n == 1)
+				cache::deallocate(p);
+			else
+				::operator delete(p);
+		}
+
+		void construct(pointer p, const_reference val)	{ new(p) T(val); }
+		void destroy(pointer p)							{ p->~T(); }
+};
+
+template <class T, class U>
+bool operator==(caching_allocator<T> const &, caching_allocator<U> const &) { return true; }
+
+template <class T, class U>
+bool operator!=(caching_allocator<T> const &, caching_allocator<U> const &) { return false; }
+
+} /* namespace: ft */
+
+#endif /* __CACHING_ALLOCATOR_HPP__ */
@@ -0,0 +1,89 @@
+/* compressed_pair.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __COMPRESSED_PAIR_HPP__
+# define __COMPRESSED_PAIR_HPP__
+
+# include "type_traits.hpp"
+
+namespace ft
+{
+
+/* One element of a compressed_pair. An empty T is stored as a base
+ * class, where it takes no room, anything else as a member. Index keeps
+ * the two elements distinct types when T1 and T2 are the same.
+ */
+template <typename T, int Index, bool Empty = is_empty<T>::value>
+class compressed_pair_element
+{
+	private:
+		T	_value;
+
+	public:
+		compressed_pair_element(void) : _value() { }
+		compressed_pair_element(T const &value) : _value(value) { }
+
+		T		&get(void)			{ return _value; }
+		T const	&get(void) const	{ return _value; }
+};
+
+template <typename T, int Index>
+class compressed_pair_element<T, Index, true> : private T
+{
+	public:
+		compressed_pair_element(void) : T() { }
+		compressed_pair_element(T const &value) : T(value) { }
+
+		T		&get(void)			{ return *this; }
+		T const	&get(void) const	{ return *this; }
+};
+
+/* A pair that takes no room for an element of an empty class type, such
+ * as a stateless allocator or comparator. The elements are reached with
+ * first() and second().
+ *
+ * An empty element only disappears if the pair holds something else: the
+ * pair itself is still at least one byte, so pair a stateless object with
+ * a data member of the container rather than storing it alone.
+ */
+template <typename T1, typename T2>
+class compressed_pair
+	: private compressed_pair_element<T1, 0>
+	, private compressed_pair_element<T2, 1>
+{
+	private:
+		typedef compressed_pair_element<T1, 0>	first_base;
+		typedef compressed_pair_element<T2, 1>	second_base;
+
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef T1	first_type;
+		typedef T2	second_type;
+
+	/*------------------------------------------------------------*/
+	/*--- Member functions                                     ---*/
+	/*------------------------------------------------------------*/
+
+		/* Value-initializes both elements. */
+		compressed_pair(void) : first_base(), second_base() { }
+
+		/* Initializes first with x and value-initializes second. */
+		explicit compressed_pair(T1 const &x) : first_base(x), second_base() { }
+
+		/* Initializes first with x and second with y. */
+		compressed_pair(T1 const &x, T2 const &y) : first_base(x), second_base(y) { }
+
+		T1			&first(void)		{ return static_cast<first_base &>(*this).get(); }
+		T1 const	&first(void) const	{ return static_cast<first_base const &>(*this).get(); }
+		T2			&second(void)		{ return static_cast<second_base &>(*this).get(); }
+		T2 const	&second(void) const	{ return static_cast<second_base const &>(*this).get(); }
+};
+
+} /* namespace: ft */
+
+#endif /* __COMPRESSED_PAIR_HPP__ */
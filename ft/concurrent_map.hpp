@@ -0,0 +1,241 @@
+/* concurrent_map.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __CONCURRENT_MAP_HPP__
+# define __CONCURRENT_MAP_HPP__
+
+# include "persistent_map.hpp"
+# include "epoch.hpp"
+# include "pair.hpp"
+# include "less.hpp"
+# include <memory>
+# include <assert.h>
+# include <pthread.h>
+
+namespace ft
+{
+
+/* Ordered map that many threads can read while others modify it.
+ *
+ * The contents are a persistent_map, published through one pointer.
+ * Readers load the pointer and search the tree it points to: they take
+ * no lock, write nothing shared and never wait. Writers are serialized by
+ * a mutex: a writer makes a new version, which shares all but the
+ * O(log n) nodes on the path it changes, publishes it with one store and
+ * retires the old one to ft::epoch, which releases it once no reader can
+ * be looking at it.
+ *
+ * The lookup functions must be called inside an ft::epoch_guard, and the
+ * iterators and references they return are valid until the guard is
+ * left. Each call sees one whole version of the map; to keep a version
+ * past the guard, take a snapshot(). Versions may be released after the
+ * map is gone, so Allocator must be stateless.
+ */
+template <
+	class Key,
+	class T,
+	class Compare = ft::less<Key>,
+	class Allocator = std::allocator<ft::pair<Key const, T> > >
+class concurrent_map
+{
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef persistent_map<Key, T, Compare, Allocator>	snapshot_type;
+		typedef typename snapshot_type::key_type			key_type;
+		typedef typename snapshot_type::mapped_type			mapped_type;
+		typedef typename snapshot_type::value_type			value_type;
+		typedef typename snapshot_type::key_compare			key_compare;
+		typedef typename snapshot_type::allocator_type		allocator_type;
+		typedef typename snapshot_type::const_reference		const_reference;
+		typedef typename snapshot_type::size_type			size_type;
+		typedef typename snapshot_type::difference_type		difference_type;
+		typedef typename snapshot_type::const_iterator		const_iterator;
+		typedef const_iterator								iterator;
+
+	private:
+		snapshot_type		*_current;	/* the version readers see */
+		pthread_mutex_t		_lock;		/* held by writers */
+
+		concurrent_map(concurrent_map const &);
+		concurrent_map &operator=(concurrent_map const &);
+
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Construct/destroy                                    ---*/
+	/*------------------------------------------------------------*/
+
+		explicit concurrent_map(key_compare const &comp = key_compare())
+			: _current(new snapshot_type(comp))
+		{ pthread_mutex_init(&_lock, 0); }
+
+		/* No thread may be using the map anymore. */
+		~concurrent_map(void)
+		{
+			delete _current;
+			pthread_mutex_destroy(&_lock);
+		}
+
+	/*------------------------------------------------------------*/
+	/*--- Lookup                                               ---*/
+	/*------------------------------------------------------------*/
+
+		size_type	size(void) const	{ return _version().size(); }
+		bool		empty(void) const	{ return _version().empty(); }
+
+		key_compare key_comp(void) const { return _version().key_comp(); }
+
+		const_iterator	begin(void) const	{ return _version().begin(); }
+		const_iterator	end(void) const		{ return _version().end(); }
+
+		const_iterator	find(key_type const &k) const			{ return _version().find(k); }
+		const_iterator	lower_bound(key_type const &k) const	{ return _version().lower_bound(k); }
+		const_iterator	upper_bound(key_type const &k) const	{ return _version().upper_bound(k); }
+		size_type		count(key_type const &k) const			{ return _version().count(k); }
+
+		ft::pair<const_iterator, const_iterator> equal_range(key_type const &k) const
+		{
+			return _version().equal_range(k);
+		}
+
+		/* Returns a reference to the mapped value of the element identified with key k. */
+		mapped_type const &at(key_type const &k) const { return _version().at(k); }
+
+		/* Returns the current version, which stays valid and unchanged
+		 * outside of any guard. This is O(1), and needs no guard.
+		 */
+		snapshot_type snapshot(void) const
+		{
+			epoch_guard guard;
+
+			return *__atomic_load_n(&_current, __ATOMIC_ACQUIRE);
+		}
+
+	/*------------------------------------------------------------*/
+	/*--- Modifiers                                            ---*/
+	/*------------------------------------------------------------*/
+
+		/* Inserts val if its key is not in the map yet. Returns true if
+		 * it was inserted.
+		 */
+		bool insert(value_type const &val)
+		{
+			pthread_mutex_lock(&_lock);
+			if (_current->count(val.first)) {
+				pthread_mutex_unlock(&_lock);
+				return false;
+			}
+
+			snapshot_type *next = _next();
+
+			try {
+				next->insert(val);
+			} catch (...) {
+				_abandon(next);
+				throw ;
+			}
+			_publish(next);
+			return true;
+		}
+
+		/* Inserts an element with key k and value v, or replaces the one
+		 * with key k. Returns true if it was inserted.
+		 */
+		bool insert_or_assign(key_type const &k, mapped_type const &v)
+		{
+			pthread_mutex_lock(&_lock);
+
+			snapshot_type	*next = _next();
+			bool			inserted;
+
+			try {
+				inserted = next->assign(value_type(k, v));
+			} catch (...) {
+				_abandon(next);
+				throw ;
+			}
+			_publish(next);
+			return inserted;
+		}
+
+		/* Removes the element with key k. Returns the number of elements
+		 * removed.
+		 */
+		size_type erase(key_type const &k)
+		{
+			pthread_mutex_lock(&_lock);
+			if (!_current->count(k)) {
+				pthread_mutex_unlock(&_lock);
+				return 0;
+			}
+
+			snapshot_type *next = _next();
+
+			try {
+				next->erase(k);
+			} catch (...) {
+				_abandon(next);
+				throw ;
+			}
+			_publish(next);
+			return 1;
+		}
+
+		void clear(void)
+		{
+			pthread_mutex_lock(&_lock);
+			_publish(_next(true));
+		}
+
+	private:
+		snapshot_type const &_version(void) const
+		{
+			assert(epoch::active());
+			return *__atomic_load_n(&_current, __ATOMIC_ACQUIRE);
+		}
+
+		/* Returns a copy of the current version to modify, or an empty
+		 * map. The copy shares every node, so changing it copies the
+		 * nodes it touches. Called with _lock held, which it releases if
+		 * it throws.
+		 */
+		snapshot_type *_next(bool empty = false)
+		{
+			try {
+				if (empty)
+					return new snapshot_type(_current->key_comp());
+				return new snapshot_type(*_current);
+			} catch (...) {
+				pthread_mutex_unlock(&_lock);
+				throw ;
+			}
+		}
+
+		void _abandon(snapshot_type *next)
+		{
+			delete next;
+			pthread_mutex_unlock(&_lock);
+		}
+
+		/* Makes next the current version, releases _lock and retires the
+		 * old version.
+		 */
+		void _publish(snapshot_type *next)
+		{
+			snapshot_type *old = _current;
+
+			__atomic_store_n(&_current, next, __ATOMIC_RELEASE);
+			pthread_mutex_unlock(&_lock);
+			epoch::retire(old, _delete_version);
+		}
+
+		static void _delete_version(void *p) { delete static_cast<snapshot_type *>(p); }
+};
+
+} /* namespace: ft */
+
+#endif /* __CONCURRENT_MAP_HPP__ */
@@ -0,0 +1,241 @@
+/* epoch.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __EPOCH_HPP__
+# define __EPOCH_HPP__
+
+# include <new>
+# include <stddef.h>
+# include <assert.h>
+# include <pthread.h>
+
+namespace ft
+{
+
+/* Number of objects a thread retires between two attempts to free them. */
+enum { epoch_collect_threshold = 64 };
+
+/*------------------------------------------------------------*/
+/*--- Epoch based reclamation                              ---*/
+/*------------------------------------------------------------*/
+
+/* Frees objects of lock-free structures once no reader can still be
+ * looking at them.
+ *
+ * A reader wraps its accesses in an epoch_guard, which publishes the
+ * global epoch it saw when it entered. A writer that unlinks an object
+ * retires it, tagged with the current epoch. The global epoch only moves
+ * forward when every thread inside a guard has seen the current one, so
+ * once it is two past the tag of an object, every reader that could have
+ * reached the object has left its guard, and the object is freed.
+ *
+ * Entering and leaving a guard is a store to a record of the thread,
+ * with no shared write: readers never wait for each other or for the
+ * writers. Every thread gets a record on first use; the record is given
+ * back, with the objects it retired and did not free yet, when the thread
+ * exits, and the next thread that takes it frees them.
+ *
+ * Tag only lets the static members be defined in this header.
+ */
+template <class Tag = void>
+class basic_epoch
+{
+	private:
+		/* an object waiting to be freed */
+		struct retired
+		{
+			void		*object;
+			void		(*deleter)(void *);
+			size_t		epoch;
+			retired		*next;
+		};
+
+		struct record
+		{
+			size_t		state;		/* epoch << 1 | 1 inside a guard, 0 outside */
+			size_t		depth;		/* guards the thread is inside of */
+			int			in_use;
+			record		*next;
+			retired		*first;		/* oldest retired object */
+			retired		*last;
+			size_t		count;
+		};
+
+		static __thread record	*_self;
+
+		static size_t			_global;
+		static record			*_records;	/* pushed, never removed */
+		static pthread_once_t	_once;
+		static pthread_key_t	_key;
+
+	public:
+		/* Enters a critical section: objects reachable from now on are
+		 * not freed until the matching leave. Sections nest.
+		 */
+		static void enter(void)
+		{
+			record *r = _record();
+
+			if (r->depth++)
+				return ;
+			__atomic_store_n(&r->state,
+				__atomic_load_n(&_global, __ATOMIC_SEQ_CST) << 1 | 1, __ATOMIC_SEQ_CST);
+		}
+
+		static void leave(void)
+		{
+			record *r = _self;
+
+			assert(r && r->depth);
+			if (!--r->depth)
+				__atomic_store_n(&r->state, 0, __ATOMIC_RELEASE);
+		}
+
+		/* Returns true if the calling thread is inside a critical section. */
+		static bool active(void) { return _self && _self->depth; }
+
+		/* Frees object with deleter once no critical section that could have
+		 * reached it is left. The object must be unreachable already.
+		 */
+		static void retire(void *object, void (*deleter)(void *))
+		{
+			record	*r = _record();
+			retired	*e = new retired;
+
+			e->object = object;
+			e->deleter = deleter;
+			e->epoch = __atomic_load_n(&_global, __ATOMIC_SEQ_CST);
+			e->next = 0;
+			if (r->last)
+				r->last->next = e;
+			else
+				r->first = e;
+			r->last = e;
+			if (++r->count >= epoch_collect_threshold)
+				collect();
+		}
+
+		/* Tries to move the epoch forward, then frees the objects the
+		 * calling thread retired that no reader can reach anymore.
+		 */
+		static void collect(void)
+		{
+			record	*r = _record();
+			size_t	epoch;
+
+			_try_advance();
+			epoch = __atomic_load_n(&_global, __ATOMIC_SEQ_CST);
+			while (r->first && r->first->epoch + 2 <= epoch) {
+				retired *e = r->first;
+
+				r->first = e->next;
+				if (!r->first)
+					r->last = 0;
+				--r->count;
+				e->deleter(e->object);
+				delete e;
+			}
+		}
+
+	private:
+		/* Returns the record of the calling thread, taking a free one or
+		 * adding one to the list on first use.
+		 */
+		static record *_record(void)
+		{
+			if (_self)
+				return _self;
+
+			record *r = __atomic_load_n(&_records, __ATOMIC_ACQUIRE);
+
+			for (; r; r = r->next) {
+				int unused = 0;
+
+				if (__atomic_compare_exchange_n(&r->in_use, &unused, 1, false,
+						__ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+					break;
+			}
+			if (!r) {
+				r = new record;
+				r->state = 0;
+				r->depth = 0;
+				r->in_use = 1;
+				r->first = 0;
+				r->last = 0;
+				r->count = 0;
+				r->next = __atomic_load_n(&_records, __ATOMIC_RELAXED);
+				while (!__atomic_compare_exchange_n(&_records, &r->next, r, true,
+						__ATOMIC_RELEASE, __ATOMIC_RELAXED))
+					;
+			}
+			pthread_once(&_once, _make_key);
+			pthread_setspecific(_key, r);
+			_self = r;
+			return r;
+		}
+
+		/* Moves the global epoch one step if every thread inside a
+		 * critical section has seen it.
+		 */
+		static void _try_advance(void)
+		{
+			size_t epoch = __atomic_load_n(&_global, __ATOMIC_SEQ_CST);
+
+			for (record *r = __atomic_load_n(&_records, __ATOMIC_ACQUIRE); r; r = r->next) {
+				size_t state = __atomic_load_n(&r->state, __ATOMIC_SEQ_CST);
+
+				if ((state & 1) && state >> 1 != epoch)
+					return ;
+			}
+			__atomic_compare_exchange_n(&_global, &epoch, epoch + 1, false,
+				__ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+		}
+
+		static void _make_key(void) { pthread_key_create(&_key, _thread_exit); }
+
+		/* Gives the record of an exiting thread back. */
+		static void _thread_exit(void *p)
+		{
+			record *r = static_cast<record *>(p);
+
+			assert(!r->depth);
+			__atomic_store_n(&r->in_use, 0, __ATOMIC_RELEASE);
+		}
+};
+
+template <class Tag>
+__thread typename basic_epoch<Tag>::record *basic_epoch<Tag>::_self = 0;
+
+template <class Tag>
+size_t basic_epoch<Tag>::_global = 0;
+
+template <class Tag>
+typename basic_epoch<Tag>::record *basic_epoch<Tag>::_records = 0;
+
+template <class Tag>
+pthread_once_t basic_epoch<Tag>::_once = PTHREAD_ONCE_INIT;
+
+template <class Tag>
+pthread_key_t basic_epoch<Tag>::_key;
+
+typedef basic_epoch<> epoch;
+
+/* Keeps the calling thread in a critical section of ft::epoch for its
+ * lifetime.
+ */
+class epoch_guard
+{
+	private:
+		epoch_guard(epoch_guard const &);
+		epoch_guard &operator=(epoch_guard const &);
+
+	public:
+		epoch_guard(void)	{ epoch::enter(); }
+		~epoch_guard(void)	{ epoch::leave(); }
+};
+
+} /* namespace: ft */
+
+#endif /* __EPOCH_HPP__ */
@@ -0,0 +1,196 @@
+/* eytzinger_set.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __EYTZINGER_SET_HPP__
+# define __EYTZINGER_SET_HPP__
+
+# include "vector.hpp"
+# include "less.hpp"
+# include <memory>
+# include <stddef.h>
+# include <assert.h>
+
+namespace ft
+{
+
+/* Read-only ordered set of keys stored in Eytzinger (breadth first)
+ * order: the root is at index 1 and the children of node k are at 2k and
+ * 2k + 1, so the first levels of the tree share a few cache lines and
+ * the nodes a search visits next are at predictable addresses.
+ *
+ * A search is a loop with no branch on the keys: it goes to 2k or 2k + 1
+ * with the result of the comparison as the low bit, and prefetches the
+ * descendants a few levels below, which lie next to each other (the 16
+ * nodes four levels below, for 4-byte keys). The position where the
+ * search leaves the tree gives the lower bound back: it is the last node
+ * where the search went left.
+ *
+ * Keys are compared with Compare and are unique. The rank of an element
+ * (its index in the sorted input) is computed from its position in O(1).
+ */
+template <
+	typename T,
+	typename Compare = ft::less<T>,
+	typename Allocator = std::allocator<T> >
+class eytzinger_set
+{
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef T					key_type;
+		typedef T					value_type;
+		typedef Compare				key_compare;
+		typedef Allocator			allocator_type;
+		typedef size_t				size_type;
+		typedef value_type const *	const_pointer;
+
+	private:
+		/* levels between a node and the descendants prefetched for it:
+		 * those 2^levels nodes take up to a cache line */
+		enum { prefetch_levels = sizeof(T) <= 4 ? 4 : sizeof(T) <= 8 ? 3 : sizeof(T) <= 16 ? 2 : 1 };
+
+		/* _tree[0] is unused, the n keys are at 1 to n */
+		ft::vector<value_type, allocator_type>	_tree;
+		size_type								_size;
+		size_type								_height;	/* depth of the last level */
+		key_compare								_comp;
+
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Construct                                            ---*/
+	/*------------------------------------------------------------*/
+
+		/* Constructs an empty set. */
+		explicit eytzinger_set(key_compare const &comp = key_compare())
+			: _size(0)
+			, _height(0)
+			, _comp(comp)
+		{ }
+
+		/* Constructs the set of the keys in sorted, which must be sorted
+		 * by comp and hold no equivalent keys.
+		 */
+		explicit eytzinger_set(
+			ft::vector<value_type, allocator_type> const &sorted,
+			key_compare const &comp = key_compare())
+			: _size(sorted.size())
+			, _height(0)
+			, _comp(comp)
+		{
+			if (!_size)
+				return ;
+			_tree.reserve(_size + 1);
+			_tree.assign(_size + 1, sorted[0]);
+			while (_size >> (_height + 1))
+				++_height;
+
+			size_type i = 0;
+
+			_fill(sorted, i, 1);
+		}
+
+	/*------------------------------------------------------------*/
+	/*--- Capacity                                             ---*/
+	/*------------------------------------------------------------*/
+
+		bool		empty(void) const	{ return _size == 0; }
+		size_type	size(void) const	{ return _size; }
+
+	/*------------------------------------------------------------*/
+	/*--- Lookup                                               ---*/
+	/*------------------------------------------------------------*/
+
+		/* Returns a pointer to the first key that does not go before k,
+		 * or 0 if there is none.
+		 */
+		const_pointer lower_bound(key_type const &k) const
+		{
+			size_type n = _search(k);
+
+			return n ? &_tree[n] : 0;
+		}
+
+		/* Returns a pointer to the key equivalent to k, or 0. */
+		const_pointer find(key_type const &k) const
+		{
+			size_type n = _search(k);
+
+			return n && !_comp(k, _tree[n]) ? &_tree[n] : 0;
+		}
+
+		size_type	count(key_type const &k) const		{ return find(k) != 0; }
+		bool		contains(key_type const &k) const	{ return find(k) != 0; }
+
+		/* Returns the number of keys that go before k, which is the index
+		 * of its lower bound in the sorted input.
+		 */
+		size_type rank(key_type const &k) const
+		{
+			size_type n = _search(k);
+
+			return n ? _rank(n) : _size;
+		}
+
+		/* Returns the index in the sorted input of the key at p, which
+		 * was returned by lower_bound or find.
+		 */
+		size_type index_of(const_pointer p) const
+		{
+			assert(p > &_tree[0] && p <= &_tree[_size]);
+			return _rank(p - &_tree[0]);
+		}
+
+	private:
+		/* Stores the keys sorted[i...] in the subtree of node n, in order. */
+		void _fill(ft::vector<value_type, allocator_type> const &sorted, size_type &i, size_type n)
+		{
+			if (n > _size)
+				return ;
+			_fill(sorted, i, 2 * n);
+			assert(!i || _comp(sorted[i - 1], sorted[i]));
+			_tree[n] = sorted[i++];
+			_fill(sorted, i, 2 * n + 1);
+		}
+
+		/* Returns the node of the lower bound of k, 0 for none. */
+		size_type _search(key_type const &k) const
+		{
+			value_type const	*tree = _size ? &_tree[0] : 0;
+			size_type			n = 1;
+
+			while (n <= _size) {
+				__builtin_prefetch(tree + (n << prefetch_levels));
+				n = 2 * n + _comp(tree[n], k);
+			}
+			/* drop the right turns taken after the last left turn */
+			return n >> __builtin_ffsl(~n);
+		}
+
+		/* In-order index of node n. If the last level were full, the
+		 * node at depth d and position p in its level would come after
+		 * (2p + 1) << (h - d) - 1 nodes; the slots of the last level
+		 * that are missing on its left are taken off.
+		 */
+		size_type _rank(size_type n) const
+		{
+			size_type depth = sizeof(size_type) * 8 - 1 - __builtin_clzl(n);
+			size_type p = n - (size_type(1) << depth);
+
+			if (depth == _height)
+				return 2 * p;
+
+			size_type last_level = _size - ((size_type(1) << _height) - 1);
+			size_type r = ((2 * p + 1) << (_height - depth)) - 1;
+			size_type left_slots = (2 * p + 1) << (_height - depth - 1);
+
+			return left_slots > last_level ? r - (left_slots - last_level) : r;
+		}
+};
+
+} /* namespace: ft */
+
+#endif /* __EYTZINGER_SET_HPP__ */
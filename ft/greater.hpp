@@ -0,0 +1,36 @@
+#ifndef __GREATER_HPP__
+# define __GREATER_HPP__
+
+# include "binary_function.hpp"
+
+namespace ft {
+
+template<typename T>
+struct greater : public binary_function<T, T, bool>
+{
+    bool operator()(
+        T const &lhs,
+        T const &rhs) const
+    {
+        return rhs < lhs;
+    }
+};
+
+/* Transparent comparator, see less<void>. */
+template<>
+struct greater<void>
+{
+    typedef void is_transparent;
+
+    template <typename T, typename U>
+    bool operator()(
+        T const &lhs,
+        U const &rhs) const
+    {
+        return rhs < lhs;
+    }
+};
+
+} /* namespace: ft */
+
+#endif /* __GREATER_HPP__ */
@@ -0,0 +1,440 @@
+/* incremental_vector.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __INCREMENTAL_VECTOR_HPP__
+# define __INCREMENTAL_VECTOR_HPP__
+
+# include "iterator_traits.hpp"
+# include "lexicographical_compare.hpp"
+# include "reverse_iterator.hpp"
+# include "equal.hpp"
+# include "type_traits.hpp"
+# include <algorithm>
+# include <memory>
+# include <iterator>
+# include <stdexcept>
+# include <assert.h>
+
+namespace ft
+{
+
+/* Random access iterator over an incremental_vector. The elements are not
+ * contiguous while the vector migrates, so the iterator holds an index
+ * and goes through operator[].
+ */
+template <typename Container, typename Value>
+class incremental_vector_iterator
+{
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef std::random_access_iterator_tag			iterator_category;
+		typedef typename ft::remove_const<Value>::type	value_type;
+		typedef Value *									pointer;
+		typedef Value &									reference;
+		typedef std::ptrdiff_t							difference_type;
+
+	private:
+		Container	*_container;
+		size_t		_index;
+
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member functions                                     ---*/
+	/*------------------------------------------------------------*/
+
+		incremental_vector_iterator(void) : _container(0), _index(0) { }
+
+		incremental_vector_iterator(Container *container, size_t index)
+			: _container(container)
+			, _index(index)
+		{ }
+
+		/* Converts an iterator to a const iterator. */
+		template <typename C, typename V>
+		incremental_vector_iterator(incremental_vector_iterator<C, V> const &other)
+			: _container(other.container())
+			, _index(other.index())
+		{ }
+
+		Container	*container(void) const	{ return _container; }
+		size_t		index(void) const		{ return _index; }
+
+		reference	operator*() const						{ return (*_container)[_index]; }
+		pointer		operator->() const						{ return &(*_container)[_index]; }
+		reference	operator[](difference_type n) const	{ return (*_container)[_index + n]; }
+
+		incremental_vector_iterator	&operator++()						{ ++_index; return *this; }
+		incremental_vector_iterator	&operator--()						{ --_index; return *this; }
+		incremental_vector_iterator	operator++(int)						{ incremental_vector_iterator tmp(*this); ++_index; return tmp; }
+		incremental_vector_iterator	operator--(int)						{ incremental_vector_iterator tmp(*this); --_index; return tmp; }
+		incremental_vector_iterator	&operator+=(difference_type n)		{ _index += n; return *this; }
+		incremental_vector_iterator	&operator-=(difference_type n)		{ _index -= n; return *this; }
+		incremental_vector_iterator	operator+(difference_type n) const	{ return incremental_vector_iterator(_container, _index + n); }
+		incremental_vector_iterator	operator-(difference_type n) const	{ return incremental_vector_iterator(_container, _index - n); }
+
+		difference_type operator-(incremental_vector_iterator const &rhs) const
+		{ return static_cast<difference_type>(_index) - static_cast<difference_type>(rhs._index); }
+
+		bool operator==(incremental_vector_iterator const &rhs) const	{ return _index == rhs._index; }
+		bool operator!=(incremental_vector_iterator const &rhs) const	{ return _index != rhs._index; }
+		bool operator<(incremental_vector_iterator const &rhs) const	{ return _index < rhs._index; }
+		bool operator<=(incremental_vector_iterator const &rhs) const	{ return _index <= rhs._index; }
+		bool operator>(incremental_vector_iterator const &rhs) const	{ return _index > rhs._index; }
+		bool operator>=(incremental_vector_iterator const &rhs) const	{ return _index >= rhs._index; }
+};
+
+/* A vector that never copies its whole buffer in one call.
+ *
+ * When it runs out of capacity, it allocates a buffer twice as large but
+ * leaves the elements in the old one. Every later push_back or pop_back
+ * then moves migrate_step elements to the new buffer, and the old buffer
+ * is freed once it is empty. Elements [_migrated, _old_size) live in the
+ * old buffer, all the others in the new one, and operator[] checks which
+ * buffer to read with a single comparison.
+ *
+ * The old buffer holds at most half of the new capacity, so it is empty
+ * before the new buffer fills up. The cost of a push_back is therefore
+ * bounded by migrate_step copies, instead of size() copies for ft::vector.
+ * Element addresses are not stable while elements migrate.
+ */
+template <typename T, typename Allocator = std::allocator<T> >
+class incremental_vector
+{
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef T												value_type;
+		typedef Allocator										allocator_type;
+		typedef typename allocator_type::const_pointer			const_pointer;
+		typedef typename allocator_type::pointer				pointer;
+		typedef typename allocator_type::const_reference		const_reference;
+		typedef typename allocator_type::reference				reference;
+		typedef incremental_vector_iterator<incremental_vector, T>				iterator;
+		typedef incremental_vector_iterator<incremental_vector const, T const>	const_iterator;
+		typedef ft::reverse_iterator<iterator>					reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+		typedef std::ptrdiff_t									difference_type;
+		typedef size_t											size_type;
+
+		/* Elements moved to the new buffer per push_back or pop_back. */
+		enum { migrate_step = 4 };
+
+	/*------------------------------------------------------------*/
+	/*--- Private members                                      ---*/
+	/*------------------------------------------------------------*/
+
+	private:
+		Allocator	_allocator;
+		pointer		_data;
+		size_type	_size;
+		size_type	_capacity;
+		pointer		_old;
+		size_type	_old_capacity;
+		size_type	_migrated;
+		size_type	_old_size;
+		size_type	_pending;	/* capacity reserved while migrating */
+
+	/*------------------------------------------------------------*/
+	/*--- Construct/copy/destroy                               ---*/
+	/*------------------------------------------------------------*/
+
+	public:
+		/* Constructs an empty container, with no elements. */
+		explicit incremental_vector(Allocator const &alloc = Allocator())
+			: _allocator(alloc)
+			, _data(0)
+			, _size(0)
+			, _capacity(0)
+			, _old(0)
+			, _old_capacity(0)
+			, _migrated(0)
+			, _old_size(0)
+			, _pending(0)
+		{ }
+
+		/* Constructs a container with a copy of each of the
+		 * elements in x, in the same order.
+		 */
+		incremental_vector(incremental_vector const &x)
+			: _allocator(x._allocator)
+			, _data(0)
+			, _size(0)
+			, _capacity(0)
+			, _old(0)
+			, _old_capacity(0)
+			, _migrated(0)
+			, _old_size(0)
+			, _pending(0)
+		{
+			reserve(x.size());
+			for (size_type i = 0; i < x.size(); ++i)
+				push_back(x[i]);
+		}
+
+		~incremental_vector(void)
+		{
+			_pending = 0;
+			clear();
+			if (_capacity)
+				_allocator.deallocate(_data, _capacity);
+		}
+
+		incremental_vector &operator=(incremental_vector const &x)
+		{
+			if (this != &x) {
+				clear();
+				reserve(x.size());
+				for (size_type i = 0; i < x.size(); ++i)
+					push_back(x[i]);
+			}
+			return *this;
+		}
+
+		allocator_type get_allocator(void) const { return _allocator; }
+
+	/*------------------------------------------------------------*/
+	/*--- Iterators                                            ---*/
+	/*------------------------------------------------------------*/
+
+		iterator		begin(void)			{ return iterator(this, 0); }
+		const_iterator	begin(void) const	{ return const_iterator(this, 0); }
+		iterator		end(void)			{ return iterator(this, _size); }
+		const_iterator	end(void) const		{ return const_iterator(this, _size); }
+
+		reverse_iterator		rbegin(void)		{ return reverse_iterator(end()); }
+		const_reverse_iterator	rbegin(void) const	{ return const_reverse_iterator(end()); }
+		reverse_iterator		rend(void)			{ return reverse_iterator(begin()); }
+		const_reverse_iterator	rend(void) const	{ return const_reverse_iterator(begin()); }
+
+	/*------------------------------------------------------------*/
+	/*--- Capacity                                             ---*/
+	/*------------------------------------------------------------*/
+
+		size_type	size(void) const		{ return _size; }
+		size_type	capacity(void) const	{ return _capacity; }
+		size_type	max_size(void) const	{ return _allocator.max_size(); }
+		bool		empty(void) const		{ return _size == 0; }
+
+		/* Returns whether elements are still waiting in the old buffer. */
+		bool		migrating(void) const	{ return _old != 0; }
+
+		/* Requests that the capacity be at least n. The elements are
+		 * moved incrementally, like when the vector grows on its own.
+		 *
+		 * There is at most one old buffer at a time: while elements
+		 * still migrate, the new buffer is only allocated once they are
+		 * all moved, and capacity() stays below n until then. The buffer
+		 * has room for the push_backs that move every element of the
+		 * old one, so it never fills up before that.
+		 */
+		void reserve(size_type n)
+		{
+			assert(n < max_size());
+
+			if (n <= _capacity)
+				return ;
+			if (_old) {
+				_pending = std::max(_pending, n);
+				return ;
+			}
+			n = std::max(n, _size + (_size + migrate_step - 1) / migrate_step);
+
+			pointer ptr = _allocator.allocate(n);
+
+			if (_size) {
+				_old = _data;
+				_old_capacity = _capacity;
+				_migrated = 0;
+				_old_size = _size;
+			} else if (_capacity)
+				_allocator.deallocate(_data, _capacity);
+			_data = ptr;
+			_capacity = n;
+		}
+
+		/* Moves all the remaining elements to the new buffer now. */
+		void finish_migration(void)
+		{
+			if (_old)
+				_migrate(_old_size - _migrated);
+		}
+
+	/*------------------------------------------------------------*/
+	/*--- Element access                                       ---*/
+	/*------------------------------------------------------------*/
+
+		reference operator[](size_type n)
+		{
+			if (n - _migrated < _old_size - _migrated)
+				return _old[n];
+			return _data[n];
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			if (n - _migrated < _old_size - _migrated)
+				return _old[n];
+			return _data[n];
+		}
+
+		reference at(size_type n)
+		{
+			if (n >= _size)
+				throw std::out_of_range("index out of range");
+			return (*this)[n];
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= _size)
+				throw std::out_of_range("index out of range");
+			return (*this)[n];
+		}
+
+		reference		front(void)			{ assert(!empty()); return (*this)[0]; }
+		const_reference	front(void) const	{ assert(!empty()); return (*this)[0]; }
+		reference		back(void)			{ assert(!empty()); return (*this)[_size - 1]; }
+		const_reference	back(void) const	{ assert(!empty()); return (*this)[_size - 1]; }
+
+	/*------------------------------------------------------------*/
+	/*--- Modifiers                                            ---*/
+	/*------------------------------------------------------------*/
+
+		/* Adds x at the end. This moves at most migrate_step elements,
+		 * on top of the allocation when the vector grows.
+		 */
+		void push_back(value_type const &x)
+		{
+			if (_size == _capacity) {
+				assert(!_old);
+				reserve(_capacity ? _capacity * 2 : 1);
+			}
+			_allocator.construct(_data + _size, x);
+			++_size;
+			_migrate(migrate_step);
+		}
+
+		void pop_back(void)
+		{
+			assert(!empty());
+
+			--_size;
+			if (_size >= _migrated && _size < _old_size)
+				_allocator.destroy(_old + --_old_size);
+			else
+				_allocator.destroy(_data + _size);
+			_migrate(migrate_step);
+		}
+
+		void swap(incremental_vector &x)
+		{
+			assert(_allocator == x._allocator);
+
+			std::swap(_allocator, x._allocator);
+			std::swap(_data, x._data);
+			std::swap(_size, x._size);
+			std::swap(_capacity, x._capacity);
+			std::swap(_old, x._old);
+			std::swap(_old_capacity, x._old_capacity);
+			std::swap(_migrated, x._migrated);
+			std::swap(_old_size, x._old_size);
+			std::swap(_pending, x._pending);
+		}
+
+		void clear(void)
+		{
+			while (!empty())
+				pop_back();
+			_release_old();
+		}
+
+	private:
+		/* Moves up to n elements from the old buffer to the new one. */
+		void _migrate(size_type n)
+		{
+			if (!_old)
+				return ;
+			for (; n && _migrated < _old_size; --n, ++_migrated) {
+				_allocator.construct(_data + _migrated, _old[_migrated]);
+				_allocator.destroy(_old + _migrated);
+			}
+			if (_migrated == _old_size)
+				_release_old();
+		}
+
+		/* Frees the old buffer, then starts the reserve that waited for it. */
+		void _release_old(void)
+		{
+			if (_old)
+				_allocator.deallocate(_old, _old_capacity);
+			_old = 0;
+			_old_capacity = 0;
+			_migrated = 0;
+			_old_size = 0;
+			if (_pending) {
+				size_type n = _pending;
+
+				_pending = 0;
+				reserve(n);
+			}
+		}
+};
+
+/*------------------------------------------------------------*/
+/*--- Non member functions                                 ---*/
+/*------------------------------------------------------------*/
+
+template <class T, class Allocator>
+inline bool operator==(
+	incremental_vector<T, Allocator> const &x,
+	incremental_vector<T, Allocator> const &y)
+{
+	return x.size() == y.size()
+		&& ft::equal(x.begin(), x.end(), y.begin());
+}
+
+template <class T, class Allocator>
+inline bool operator!=(
+	incremental_vector<T, Allocator> const &x,
+	incremental_vector<T, Allocator> const &y) { return !(x == y); }
+
+template <class T, class Allocator>
+inline bool operator<(
+	incremental_vector<T, Allocator> const &x,
+	incremental_vector<T, Allocator> const &y)
+{
+	return ft::lexicographical_compare(
+		x.begin(), x.end(),
+		y.begin(), y.end());
+}
+
+template <class T, class Allocator>
+inline bool operator>(
+	incremental_vector<T, Allocator> const &x,
+	incremental_vector<T, Allocator> const &y) { return y < x; }
+
+template <class T, class Allocator>
+inline bool operator>=(
+	incremental_vector<T, Allocator> const &x,
+	incremental_vector<T, Allocator> const &y) { return !(x < y); }
+
+template <class T, class Allocator>
+inline bool operator<=(
+	incremental_vector<T, Allocator> const &x,
+	incremental_vector<T, Allocator> const &y) { return !(y < x); }
+
+template <class T, class Allocator>
+void swap(
+	incremental_vector<T, Allocator> &x,
+	incremental_vector<T, Allocator> &y) { x.swap(y); }
+
+} /* namespace: ft */
+
+#endif /* __INCREMENTAL_VECTOR_HPP__ */
@@ -0,0 +1,429 @@
+/* intrusive_map.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __INTRUSIVE_MAP_HPP__
+# define __INTRUSIVE_MAP_HPP__
+
+# include "rb_tree.hpp"
+# include "pair.hpp"
+# include "less.hpp"
+# include "reverse_iterator.hpp"
+# include "type_traits.hpp"
+# include <iterator>
+# include <stddef.h>
+# include <assert.h>
+
+namespace ft
+{
+
+/*------------------------------------------------------------*/
+/*--- Hook                                                 ---*/
+/*------------------------------------------------------------*/
+
+/* The links an object needs to be in an intrusive_map. The object
+ * derives from the hook; an object in several maps at once derives from
+ * one hook per map, told apart by Tag.
+ *
+ * Copying an object does not copy its links: the copy is in no map.
+ */
+template <class Tag = void>
+struct intrusive_hook : rb_node_base
+{
+	intrusive_hook(void) { parent = 0; }
+	intrusive_hook(intrusive_hook const &) : rb_node_base() { parent = 0; }
+	intrusive_hook &operator=(intrusive_hook const &) { return *this; }
+
+	/* An object must leave its map before it is destroyed. */
+	~intrusive_hook(void) { assert(!is_linked()); }
+
+	bool is_linked(void) const { return parent != 0; }
+};
+
+/* Key extractor that returns the data member Member of a T. */
+template <class T, class Key, Key T::*Member>
+struct member_key
+{
+	typedef Key result_type;
+
+	Key const &operator()(T const &x) const { return x.*Member; }
+};
+
+/*------------------------------------------------------------*/
+/*--- Iterator                                             ---*/
+/*------------------------------------------------------------*/
+
+/* Bidirectional iterator over the objects of an intrusive_map.
+ * Value is const qualified for const iterators.
+ */
+template <typename Hook, typename Value>
+class intrusive_map_iterator
+{
+	public:
+		typedef std::bidirectional_iterator_tag	iterator_category;
+		typedef Value							value_type;
+		typedef Value *							pointer;
+		typedef Value &							reference;
+		typedef std::ptrdiff_t					difference_type;
+
+	private:
+		rb_node_base	*_node;
+
+	public:
+		intrusive_map_iterator(void) : _node(0) { }
+
+		explicit intrusive_map_iterator(rb_node_base const *node)
+			: _node(const_cast<rb_node_base *>(node))
+		{ }
+
+		/* Converts an iterator to a const iterator, never the other way.
+		 * For an iterator this is the copy constructor.
+		 */
+		intrusive_map_iterator(intrusive_map_iterator<Hook, typename remove_const<Value>::type> const &other)
+			: _node(other.node())
+		{ }
+
+		reference	operator*() const	{ return static_cast<reference>(*static_cast<Hook *>(_node)); }
+		pointer		operator->() const	{ return &**this; }
+
+		intrusive_map_iterator	&operator++()		{ _node = rb_increment(_node); return *this; }
+		intrusive_map_iterator	&operator--()		{ _node = rb_decrement(_node); return *this; }
+		intrusive_map_iterator	operator++(int)		{ intrusive_map_iterator tmp(*this); _node = rb_increment(_node); return tmp; }
+		intrusive_map_iterator	operator--(int)		{ intrusive_map_iterator tmp(*this); _node = rb_decrement(_node); return tmp; }
+
+		rb_node_base			*node(void) const	{ return _node; }
+};
+
+template <typename Hook, typename V1, typename V2>
+bool operator==(
+	intrusive_map_iterator<Hook, V1> const &lhs,
+	intrusive_map_iterator<Hook, V2> const &rhs) { return lhs.node() == rhs.node(); }
+
+template <typename Hook, typename V1, typename V2>
+bool operator!=(
+	intrusive_map_iterator<Hook, V1> const &lhs,
+	intrusive_map_iterator<Hook, V2> const &rhs) { return lhs.node() != rhs.node(); }
+
+/*------------------------------------------------------------*/
+/*--- Intrusive map                                        ---*/
+/*------------------------------------------------------------*/
+
+/* Ordered map of objects that the caller owns, with unique keys.
+ *
+ * The map is a red-black tree, like ft::map, whose nodes are the
+ * intrusive_hook<Tag> base of the objects: inserting and erasing never
+ * allocate, copy or destroy anything. The key of an object is
+ * KeyOfValue()(object), which must not change while it is in the map.
+ * An object can be erased from a reference to it, with no lookup, and
+ * iterator_to gives its position in O(1).
+ *
+ * The map does not own the objects: erasing or clearing unlinks them,
+ * and the objects must outlive their stay in the map.
+ */
+template <
+	class T,
+	class KeyOfValue,
+	class Compare = less<typename KeyOfValue::result_type>,
+	class Tag = void>
+class intrusive_map
+{
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef typename KeyOfValue::result_type							key_type;
+		typedef T															value_type;
+		typedef Compare														key_compare;
+		typedef T &															reference;
+		typedef T const &													const_reference;
+		typedef T *															pointer;
+		typedef T const *													const_pointer;
+		typedef size_t														size_type;
+		typedef std::ptrdiff_t												difference_type;
+		typedef intrusive_hook<Tag>											hook_type;
+		typedef intrusive_map_iterator<hook_type, T>						iterator;
+		typedef intrusive_map_iterator<hook_type, T const>					const_iterator;
+		typedef ft::reverse_iterator<iterator>								reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>						const_reverse_iterator;
+
+	private:
+		rb_node_base	_header;
+		size_type		_size;
+		key_compare		_comp;
+
+		intrusive_map(intrusive_map const &);
+		intrusive_map &operator=(intrusive_map const &);
+
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Construct/destroy                                    ---*/
+	/*------------------------------------------------------------*/
+
+		explicit intrusive_map(key_compare const &comp = key_compare())
+			: _comp(comp)
+		{ _reset(); }
+
+		/* Unlinks the objects left. */
+		~intrusive_map(void) { clear(); }
+
+	/*------------------------------------------------------------*/
+	/*--- Iterators                                            ---*/
+	/*------------------------------------------------------------*/
+
+		iterator		begin(void)			{ return iterator(_header.next); }
+		const_iterator	begin(void) const	{ return const_iterator(_header.next); }
+
+		iterator		end(void)			{ return iterator(&_header); }
+		const_iterator	end(void) const		{ return const_iterator(&_header); }
+
+		reverse_iterator		rbegin(void)		{ return reverse_iterator(end()); }
+		const_reverse_iterator	rbegin(void) const	{ return const_reverse_iterator(end()); }
+
+		reverse_iterator		rend(void)			{ return reverse_iterator(begin()); }
+		const_reverse_iterator	rend(void) const	{ return const_reverse_iterator(begin()); }
+
+		/* The position of x, which must be in this map. O(1). */
+		iterator		iterator_to(reference x)		{ return iterator(_hook(x)); }
+		const_iterator	iterator_to(const_reference x) const
+		{ return const_iterator(static_cast<hook_type const *>(&x)); }
+
+	/*------------------------------------------------------------*/
+	/*--- Capacity                                             ---*/
+	/*------------------------------------------------------------*/
+
+		bool		empty(void) const	{ return _size == 0; }
+		size_type	size(void) const	{ return _size; }
+
+	/*------------------------------------------------------------*/
+	/*--- Modifiers                                            ---*/
+	/*------------------------------------------------------------*/
+
+		/* Links x, which must be in no map, if its key is not in the map
+		 * yet. Otherwise returns the object with that key.
+		 */
+		pair<iterator, bool> insert(reference x)
+		{
+			assert(!_hook(x)->is_linked());
+
+			rb_node_base	*p = &_header;
+			rb_node_base	*y = _header.parent;
+			bool			left = true;
+
+			while (y) {
+				p = y;
+				left = _less(_key(x), _key(y));
+				y = left ? y->left : y->right;
+			}
+
+			rb_node_base *before = p;
+
+			if (left)
+				before = p == _header.next ? 0 : rb_decrement(p);
+			if (before && !_less(_key(before), _key(x)))
+				return ft::make_pair(iterator(before), false);
+			return ft::make_pair(_insert_at(left, p, x), true);
+		}
+
+		/* x is linked right before position if that keeps the map
+		 * ordered, which is O(1) amortized for sorted input.
+		 */
+		iterator insert(iterator position, reference x)
+		{
+			rb_node_base *pos = position.node();
+
+			assert(!_hook(x)->is_linked());
+			if (pos == &_header) {
+				if (_size && _less(_key(_header.prev), _key(x)))
+					return _insert_at(false, _header.prev, x);
+				return insert(x).first;
+			}
+			if (_less(_key(x), _key(pos))) {
+				if (pos == _header.next)
+					return _insert_at(true, pos, x);
+
+				rb_node_base *before = rb_decrement(pos);
+
+				if (_less(_key(before), _key(x))) {
+					if (!before->right)
+						return _insert_at(false, before, x);
+					return _insert_at(true, pos, x);
+				}
+			}
+			return insert(x).first;
+		}
+
+		/* Unlinks x, which must be in this map. This finds x from its
+		 * links, not its key: it is O(log n) to rebalance the tree, and
+		 * compares nothing.
+		 */
+		void erase(reference x) { erase(iterator_to(x)); }
+
+		void erase(iterator position)
+		{
+			assert(position != end());
+
+			rb_node_base *x = rb_erase_and_rebalance<no_order_statistics>(position.node(), _header);
+
+			x->parent = 0;
+			--_size;
+		}
+
+		size_type erase(key_type const &k)
+		{
+			iterator it = find(k);
+
+			if (it == end())
+				return 0;
+			erase(it);
+			return 1;
+		}
+
+		void erase(iterator first, iterator last)
+		{
+			if (first == begin() && last == end()) {
+				clear();
+				return ;
+			}
+			while (first != last)
+				erase(first++);
+		}
+
+		void swap(intrusive_map &x)
+		{
+			std::swap(_header, x._header);
+			std::swap(_size, x._size);
+			std::swap(_comp, x._comp);
+			_fix_header();
+			x._fix_header();
+		}
+
+		/* Unlinks every object. O(n), to mark them unlinked. */
+		void clear(void)
+		{
+			for (rb_node_base *x = _header.next; x != &_header; x = x->next)
+				x->parent = 0;
+			_reset();
+		}
+
+	/*------------------------------------------------------------*/
+	/*--- Observers                                            ---*/
+	/*------------------------------------------------------------*/
+
+		key_compare key_comp(void) const { return _comp; }
+
+	/*------------------------------------------------------------*/
+	/*--- Operations                                           ---*/
+	/*------------------------------------------------------------*/
+
+		iterator		find(key_type const &k)			{ return iterator(_find(k)); }
+		const_iterator	find(key_type const &k) const	{ return const_iterator(_find(k)); }
+
+		size_type count(key_type const &k) const { return _find(k) != &_header; }
+
+		iterator		lower_bound(key_type const &k)			{ return iterator(_lower_bound(k)); }
+		const_iterator	lower_bound(key_type const &k) const	{ return const_iterator(_lower_bound(k)); }
+
+		iterator		upper_bound(key_type const &k)			{ return iterator(_upper_bound(k)); }
+		const_iterator	upper_bound(key_type const &k) const	{ return const_iterator(_upper_bound(k)); }
+
+		pair<iterator, iterator> equal_range(key_type const &k)
+		{ return ft::make_pair(lower_bound(k), upper_bound(k)); }
+
+		pair<const_iterator, const_iterator> equal_range(key_type const &k) const
+		{ return ft::make_pair(lower_bound(k), upper_bound(k)); }
+
+	/*------------------------------------------------------------*/
+	/*--- Tree                                                 ---*/
+	/*------------------------------------------------------------*/
+
+	private:
+		static hook_type *_hook(reference x) { return static_cast<hook_type *>(&x); }
+
+		static key_type const &_key(const_reference x) { return KeyOfValue()(x); }
+
+		static key_type const &_key(rb_node_base const *x)
+		{ return _key(static_cast<const_reference>(*static_cast<hook_type const *>(x))); }
+
+		bool _less(key_type const &a, key_type const &b) const { return _comp(a, b); }
+
+		iterator _insert_at(bool left, rb_node_base *parent, reference x)
+		{
+			rb_insert_and_rebalance<no_order_statistics>(left, _hook(x), parent, _header);
+			++_size;
+			return iterator(_hook(x));
+		}
+
+		rb_node_base *_lower_bound(key_type const &k) const
+		{
+			rb_node_base const *x = _header.parent;
+			rb_node_base const *y = &_header;
+
+			while (x) {
+				if (!_less(_key(x), k)) {
+					y = x;
+					x = x->left;
+				} else
+					x = x->right;
+			}
+			return const_cast<rb_node_base *>(y);
+		}
+
+		rb_node_base *_upper_bound(key_type const &k) const
+		{
+			rb_node_base const *x = _header.parent;
+			rb_node_base const *y = &_header;
+
+			while (x) {
+				if (_less(k, _key(x))) {
+					y = x;
+					x = x->left;
+				} else
+					x = x->right;
+			}
+			return const_cast<rb_node_base *>(y);
+		}
+
+		rb_node_base *_find(key_type const &k) const
+		{
+			rb_node_base *y = _lower_bound(k);
+
+			if (y == &_header || _less(k, _key(y)))
+				return const_cast<rb_node_base *>(&_header);
+			return y;
+		}
+
+		void _reset(void)
+		{
+			_header.color = rb_red;
+			_header.parent = 0;
+			_header.left = 0;
+			_header.right = 0;
+			_header.next = &_header;
+			_header.prev = &_header;
+			_size = 0;
+		}
+
+		/* The root and both ends of the list point back to the header,
+		 * which must be updated when the header moves to another map.
+		 */
+		void _fix_header(void)
+		{
+			if (_header.parent) {
+				_header.parent->parent = &_header;
+				_header.next->prev = &_header;
+				_header.prev->next = &_header;
+			} else
+				_reset();
+		}
+};
+
+template <class T, class KeyOfValue, class Compare, class Tag>
+void swap(
+	intrusive_map<T, KeyOfValue, Compare, Tag> &x,
+	intrusive_map<T, KeyOfValue, Compare, Tag> &y) { x.swap(y); }
+
+} /* namespace: ft */
+
+#endif /* __INTRUSIVE_MAP_HPP__ */
@@ -12,7 +12,25 @@ struct less : public binary_function<T, T, bool>
         T const &lhs,
         T const &rhs) const
     {
-        return lhs < rhs
+        return lhs < rhs;
+    }
+};
+
+/* Transparent comparator: compares objects of any two types with <, so
+ * that a map keyed by std::string can be searched with a char const *
+ * without building a std::string first.
+ */
+template<>
+struct less<void>
+{
+    typedef void is_transparent;
+
+    template <typename T, typename U>
+    bool operator()(
+        T const &lhs,
+        U const &rhs) const
+    {
+        return lhs < rhs;
     }
 };
 
@@ -10,16 +10,136 @@
 # include "pair.hpp"
 # include "iterator_traits.hpp"
 # include "equal.hpp"
+# include "lexicographical_compare.hpp"
 # include "reverse_iterator.hpp"
 # include "less.hpp"
+# include "binary_function.hpp"
+# include "type_traits.hpp"
+# include "rb_tree.hpp"
+# include "vector.hpp"
+# include "compressed_pair.hpp"
+# include "trace.hpp"
 # include <memory>
+# include <stdexcept>
+# include <assert.h>
+
 namespace ft {
 
+/* Owns a node extracted from a map (map::node_type).
+ *
+ * Like std::auto_ptr, copying a handle transfers the node: the source is
+ * left empty. This lets m2.insert(m1.extract(k)) move an element between
+ * maps without any allocation or copy of the element. The key of an owned
+ * node can be changed through key() before inserting it again.
+ */
+template <class Node, class Allocator>
+class map_node_handle
+{
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef typename Node::value_type::first_type	const_key_type;
+		typedef typename Node::value_type::second_type	mapped_type;
+		typedef Allocator								allocator_type;
+
+	private:
+		typedef typename Allocator::template rebind<Node>::other	node_allocator;
+
+		mutable Node	*_node;
+		allocator_type	_allocator;
+
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member functions                                     ---*/
+	/*------------------------------------------------------------*/
+
+		map_node_handle(void) : _node(0), _allocator() { }
+
+		map_node_handle(Node *node, allocator_type const &alloc)
+			: _node(node)
+			, _allocator(alloc)
+		{ }
+
+		/* Takes the node of other, which becomes empty. */
+		map_node_handle(map_node_handle const &other)
+			: _node(other.release())
+			, _allocator(other._allocator)
+		{ }
+
+		map_node_handle &operator=(map_node_handle const &other)
+		{
+			if (this != &other) {
+				_destroy();
+				_node = other.release();
+				_allocator = other._allocator;
+			}
+			return *this;
+		}
+
+		/* Destroys the element and frees the node, if any. */
+		~map_node_handle(void) { _destroy(); }
+
+		bool			empty(void) const			{ return _node == 0; }
+		allocator_type	get_allocator(void) const	{ return _allocator; }
+
+		/* The key is const in the map, but the node is not in a map. */
+		typename ft::remove_const<const_key_type>::type &key(void) const
+		{
+			assert(_node);
+			return const_cast<typename ft::remove_const<const_key_type>::type &>(_node->value.first);
+		}
+
+		mapped_type &mapped(void) const { assert(_node); return _node->value.second; }
+
+		/* Gives up ownership of the node. Used by map::insert. */
+		Node *release(void) const
+		{
+			Node *node = _node;
+
+			_node = 0;
+			return node;
+		}
+
+	private:
+		void _destroy(void)
+		{
+			if (!_node)
+				return ;
+			_allocator.destroy(&_node->value);
+			node_allocator(_allocator).deallocate(_node, 1);
+			_node = 0;
+		}
+};
+
+/* Result of map::insert(node_type). If the key was already in the map,
+ * inserted is false, position refers to the element with that key and
+ * node still owns the node that was passed in.
+ */
+template <class Iterator, class NodeHandle>
+struct map_insert_return
+{
+	Iterator	position;
+	bool		inserted;
+	NodeHandle	node;
+};
+
+/* Policy is no_order_statistics by default. With order_statistics every
+ * node also stores the size of its subtree, which enables nth(), rank(),
+ * index_of() and distance() in O(log n).
+ *
+ * Trace is no_trace by default. With operation_trace the map counts the
+ * element copies, destructions, comparator calls and node allocations
+ * it makes; the counts of a map are not synchronized, even for lookups.
+ */
 template <
     class Key,
     class T,
     class Compare = less<Key>,
-    class Allocator = std::allocator<pair<const Key, T> >
+    class Allocator = std::allocator<pair<const Key, T> >,
+    class Policy = no_order_statistics,
+    class Trace = no_trace
 >
 class map {
 
@@ -39,77 +159,210 @@ class map {
         typedef size_t                                        size_type;
         typedef typename Allocator::pointer                   pointer;
         typedef typename Allocator::const_pointer             const_pointer;
-        //typedef typename iterator_traits<iterator>::difference_type  difference_type;
-        //typedef implementation defined iterator; // See 23.1
-        //typedef implementation defined const_iterator; // See 23.1
-        //typedef ft::reverse_iterator<iterator>                reverse_iterator;
-        //typedef ft::reverse_iterator<const_iterator>          const_reverse_iterator;  
+
+    private:
+        typedef rb_node<value_type, Policy>                   tree_node;
+        typedef typename Policy::node_base                    node_base;
+        typedef typename Allocator::template rebind<tree_node>::other	node_allocator;
+
+    public:
+        typedef rb_tree_iterator<tree_node, value_type>       iterator;
+        typedef rb_tree_iterator<tree_node, value_type const> const_iterator;
+        typedef ft::reverse_iterator<iterator>                reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>          const_reverse_iterator;
+        typedef typename iterator_traits<iterator>::difference_type  difference_type;
+        typedef map_node_handle<tree_node, Allocator>         node_type;
+        typedef map_insert_return<iterator, node_type>        insert_return_type;
+
+        /* Function object that compares two elements by their keys. */
+        class value_compare : public binary_function<value_type, value_type, bool>
+        {
+            friend class map;
+
+            protected:
+                Compare comp;
+                value_compare(Compare c) : comp(c) { }
+
+            public:
+                bool operator()(value_type const &x, value_type const &y) const
+                { return comp(x.first, y.first); }
+        };
+
+	/*------------------------------------------------------------*/
+	/*--- Private members                                      ---*/
+	/*------------------------------------------------------------*/
+
+    private:
+        typedef compressed_pair<Trace, size_type>           trace_pair;
+        typedef compressed_pair<node_allocator, trace_pair> size_pair;
+
+        node_base                                   _header;
+        /* the comparator, the allocator and the trace take no room when they are stateless */
+        compressed_pair<key_compare, size_pair>     _impl;
+
+        key_compare         &_comp(void)                    { return _impl.first(); }
+        key_compare const   &_comp(void) const              { return _impl.first(); }
+        node_allocator      &_node_allocator(void)          { return _impl.second().first(); }
+        node_allocator const &_node_allocator(void) const   { return _impl.second().first(); }
+        size_type           &_size(void)                    { return _impl.second().second().second(); }
+        size_type const     &_size(void) const              { return _impl.second().second().second(); }
+        Trace               &_trace(void) const             { return const_cast<map *>(this)->_impl.second().second().first(); }
+        allocator_type      _allocator(void) const          { return allocator_type(_node_allocator()); }
 
     /*------------------------------------------------------------*/
 	/*--- Construct/copy/destroy                               ---*/
 	/*------------------------------------------------------------*/
 
+    public:
         /* Constructs an empty container, with no elements. */
         explicit map(
             key_compare		const &comp = key_compare(),
-            allocator_type	const &alloc = allocator_type());
+            allocator_type	const &alloc = allocator_type())
+            : _impl(comp, size_pair(node_allocator(alloc), trace_pair()))
+        { _reset(); }
 
         /* Constructs a container with as many elements as the range [first,last),
          * with each element constructed from its corresponding element in that range.
          */
-        template <class InputIterator> 
+        template <class InputIterator>
         map(
             InputIterator	first,
             InputIterator	last,
             key_compare		const &comp = key_compare(),
-            allocator_type	const &alloc = allocator_type());
+            allocator_type	const &alloc = allocator_type(),
+            typename ft::enable_if< !ft::is_integral<InputIterator>::value >::type* = 0)
+            : _impl(comp, size_pair(node_allocator(alloc), trace_pair()))
+        {
+            _reset();
+            insert(first, last);
+        }
 
         /* Constructs a container with a copy of each of the elements in x. */
-        map(map const &x);
+        map(map const &x)
+            : _impl(x._comp(), size_pair(x._node_allocator(), trace_pair()))
+        {
+            _reset();
+            _copy_from(x);
+        }
 
         /* This destroys all container elements, and deallocates all the storage
          * capacity allocated by the map container using its allocator.
          */
-        ~map(void);
+        ~map(void) { clear(); }
 
         /* Copies all the elements from x into the container,
          * changing its size accordingly.
          */
-        map &operator=(map const &x);
+        map &operator=(map const &x)
+        {
+            if (this != &x) {
+                clear();
+                _comp() = x._comp();
+                _copy_from(x);
+            }
+            return *this;
+        }
 
 	/*------------------------------------------------------------*/
 	/*--- Iterators                                            ---*/
 	/*------------------------------------------------------------*/
 
         /* Returns an iterator referring to the first element in the map container. */
-        iterator		begin(void);
-        const_iterator	begin(void) const;
+        iterator		begin(void)         { return iterator(_header.next); }
+        const_iterator	begin(void) const   { return const_iterator(_header.next); }
 
         /* Returns an iterator referring to the past-the-end element in the map container. */
-        iterator		end(void);
-        const_iterator	end(void) const;
+        iterator		end(void)           { return iterator(&_header); }
+        const_iterator	end(void) const     { return const_iterator(&_header); }
 
         /* Returns a reverse iterator pointing to the last element in the
          * container (i.e., its reverse beginning).
          */
-        reverse_iterator		rbegin(void);
-        const_reverse_iterator	rbegin(void) const;
+        reverse_iterator		rbegin(void)        { return reverse_iterator(end()); }
+        const_reverse_iterator	rbegin(void) const  { return const_reverse_iterator(end()); }
 
         /* Returns a reverse iterator pointing to the theoretical element right
          * before the first element in the map container (which is considered its
          * reverse end).
          */
-        reverse_iterator		rend(void);
-        const_reverse_iterator	rend(void) const;
+        reverse_iterator		rend(void)          { return reverse_iterator(begin()); }
+        const_reverse_iterator	rend(void) const    { return const_reverse_iterator(begin()); }
 
         /* Returns whether the map container is empty (i.e. whether its size is 0). */
-        bool empty(void) const;
+        bool empty(void) const { return _size() == 0; }
 
         /* Returns the number of elements in the map container. */
-        size_type size(void) const;
+        size_type size(void) const { return _size(); }
 
         /* Returns the maximum number of elements that the map container can hold. */
-        size_type max_size(void) const;
+        size_type max_size(void) const { return _node_allocator().max_size(); }
+
+        /* Moves the elements into a single block of memory, in key order,
+         * so that a scan reads memory front to back and neighbouring keys
+         * share cache lines, as in a freshly built map. The values are
+         * copied and the tree keeps its shape; iterators, pointers and
+         * references to the elements are invalidated.
+         *
+         * The block is freed when the last of its elements is erased, or
+         * by the next compact(); until then an erased element leaves a
+         * hole in it. An element that leaves the map (extract, split, or
+         * join and merge from a compacted map) is copied out of the block.
+         */
+        void compact(void)
+        {
+            size_type   n = _size();
+            tree_node   *slab = 0;
+            size_type   i = 0;
+
+            if (n) {
+                slab = _node_allocator().allocate(n + 1);
+                _trace().allocate();
+                try {
+                    for (rb_node_base *x = _header.next; x != &_header; x = x->next, ++i) {
+                        _allocator().construct(&slab[i + 1].value, static_cast<tree_node *>(x)->value);
+                        _trace().copy();
+                    }
+                } catch (...) {
+                    while (i) {
+                        _allocator().destroy(&slab[i--].value);
+                        _trace().destroy();
+                    }
+                    _node_allocator().deallocate(slab, n + 1);
+                    throw ;
+                }
+                reinterpret_cast<slab_header *>(slab)->capacity = n + 1;
+                reinterpret_cast<slab_header *>(slab)->live = n;
+            }
+
+            rb_node_base *x = _header.next;
+
+            for (i = 1; x != &_header; ++i) {
+                rb_node_base *next = x->next;
+
+                _replace_node(x, &slab[i]);
+                _destroy_node(x);
+                x = next;
+            }
+            /* the old block went with its last element */
+            assert(!_slab());
+            _set_slab(slab);
+        }
+
+        /* Returns the share of the elements that are not stored right
+         * after the element before them in key order: 0 after compact(),
+         * close to 1 when the nodes are scattered over the heap.
+         */
+        double fragmentation(void) const
+        {
+            size_type apart = 0;
+
+            if (_size() < 2)
+                return 0;
+            for (rb_node_base const *x = _header.next; x->next != &_header; x = x->next)
+                if (static_cast<tree_node const *>(x) + 1 != static_cast<tree_node const *>(x->next))
+                    ++apart;
+            return static_cast<double>(apart) / static_cast<double>(_size() - 1);
+        }
 
 	/*------------------------------------------------------------*/
 	/*--- Element access                                       ---*/
@@ -118,11 +371,27 @@ class map {
         /* If k matches the key of an element in the container,
          * the function returns a reference to its mapped value.
          */
-        mapped_type &operator[](key_type const &k);
+        mapped_type &operator[](key_type const &k)
+        { return insert(value_type(k, mapped_type())).first->second; }
 
         /* Returns a reference to the mapped value of the element identified with key k. */
-        mapped_type			&at(key_type const &k);
-        mapped_type const	&at(key_type const &k) const;
+        mapped_type &at(key_type const &k)
+        {
+            iterator it = find(k);
+
+            if (it == end())
+                throw std::out_of_range("key not found");
+            return it->second;
+        }
+
+        mapped_type const &at(key_type const &k) const
+        {
+            const_iterator it = find(k);
+
+            if (it == end())
+                throw std::out_of_range("key not found");
+            return it->second;
+        }
 
 	/*------------------------------------------------------------*/
 	/*--- Modifiers                                            ---*/
@@ -131,28 +400,310 @@ class map {
         /* Extends the container by inserting new elements, effectively increasing
          * the container size by the number of elements inserted.
          */
-        pair<iterator,bool>	insert(value_type const &val);
-        iterator			insert(iterator position, value_type const &val);
-        
+        pair<iterator,bool> insert(value_type const &val)
+        {
+            rb_node_base    *parent;
+            bool            left;
+            rb_node_base    *same = _insert_position(val.first, parent, left);
+
+            if (same)
+                return ft::make_pair(iterator(same), false);
+            return ft::make_pair(_insert_at(left, parent, val), true);
+        }
+
+        /* The element is inserted right before position if that keeps the
+         * map ordered, which is O(1) amortized for sorted input.
+         */
+        iterator insert(iterator position, value_type const &val)
+        {
+            rb_node_base *pos = position.node();
+
+            if (pos == &_header) {
+                if (_size() && _less(_key(_header.prev), val.first))
+                    return _insert_at(false, _header.prev, val);
+                return insert(val).first;
+            }
+            if (_less(val.first, _key(pos))) {
+                if (pos == _header.next)
+                    return _insert_at(true, pos, val);
+
+                rb_node_base *before = rb_decrement(pos);
+
+                if (_less(_key(before), val.first)) {
+                    if (!before->right)
+                        return _insert_at(false, before, val);
+                    return _insert_at(true, pos, val);
+                }
+            }
+            return insert(val).first;
+        }
+
 		template <class InputIterator>
-        void 				insert(InputIterator first, InputIterator last);
+        void insert(
+            InputIterator first,
+            InputIterator last,
+            typename ft::enable_if< !ft::is_integral<InputIterator>::value >::type* = 0)
+        {
+            while (first != last)
+                insert(end(), *first++);
+        }
 
         /* Removes from the map container either a single element or
          * a range of elements ([first,last)).
          */
-        void		erase(iterator position);
-        size_type	erase(key_type const &k);
-        void		erase(iterator first, iterator last);
+        void erase(iterator position)
+        {
+            assert(position != end());
+            _destroy_node(rb_erase_and_rebalance<Policy>(position.node(), _header));
+            --_size();
+        }
+
+        size_type erase(key_type const &k)
+        {
+            iterator it = find(k);
+
+            if (it == end())
+                return 0;
+            erase(it);
+            return 1;
+        }
+
+        void erase(iterator first, iterator last)
+        {
+            if (first == begin() && last == end()) {
+                clear();
+                return ;
+            }
+            while (first != last)
+                erase(first++);
+        }
 
         /* Exchanges the content of the container by the content of x, which is
          * another map of the same type. Sizes may differ.
          */
-        void swap(map& x);
+        void swap(map& x)
+        {
+            std::swap(_header, x._header);
+            std::swap(_size(), x._size());
+            std::swap(_comp(), x._comp());
+            _fix_header();
+            x._fix_header();
+        }
 
         /* Removes all elements from the map container (which are destroyed),
          * leaving the container with a size of 0.
          */
-        void clear(void);
+        void clear(void)
+        {
+            _destroy_tree(_header.parent);
+            _reset();
+        }
+
+        /* Moves the elements of source whose key is not in the container
+         * yet into the container. Nodes are relinked, not reallocated
+         * (unless source is compacted: its elements are copied out of its
+         * block), and both trees are rebuilt in O(size() + source.size()).
+         */
+        void merge(map &source)
+        {
+            if (&source == this || source.empty())
+                return ;
+            source._release_slab();
+
+            ft::vector<rb_node_base *> merged;
+            ft::vector<rb_node_base *> rest;
+            rb_node_base *x = _header.next;
+            rb_node_base *y = source._header.next;
+
+            merged.reserve(_size() + source._size());
+            while (x != &_header && y != &source._header) {
+                if (_less(_key(x), _key(y))) {
+                    merged.push_back(x);
+                    x = rb_increment(x);
+                } else if (_less(_key(y), _key(x))) {
+                    merged.push_back(y);
+                    y = rb_increment(y);
+                } else {
+                    rest.push_back(y);
+                    y = rb_increment(y);
+                }
+            }
+            for (; x != &_header; x = rb_increment(x))
+                merged.push_back(x);
+            for (; y != &source._header; y = rb_increment(y))
+                merged.push_back(y);
+            _build(merged.data(), merged.size());
+            source._build(rest.data(), rest.size());
+        }
+
+        /* Moves the elements whose key is not less than k into a new map,
+         * which is returned. The tree is cut along the search path for k
+         * and the pieces are joined back together in O(log n).
+         *
+         * Both maps must then know their size. With order_statistics the
+         * root of each part holds it, so split is O(log n). Otherwise the
+         * smaller part is counted, and split is O(log n + min(m, n - m))
+         * for m elements moved: cutting a window off either end costs
+         * no more than destroying that window later. On a compacted map
+         * the elements are first copied out of the block, in O(n).
+         */
+        map split(key_type const &k)
+        {
+            map             other(_comp(), _allocator());
+            rb_node_base    *first;
+
+            _release_slab();
+            first = _lower_bound(k);
+            if (first == &_header)
+                return other;
+            if (first == _header.next) {
+                swap(other);
+                return other;
+            }
+
+            rb_node_base    *last = _header.prev;
+            rb_node_base    *root = _header.parent;
+            rb_node_base    *lo;
+            rb_node_base    *hi;
+            size_type       lo_height;
+            size_type       hi_height;
+            size_type       moved;
+
+            root->parent = 0;
+            _split(root, rb_black_height(root), k, lo, lo_height, hi, hi_height);
+
+            if (!Policy::count(hi, moved))
+                moved = _count_from(first);
+
+            _header.prev = first->prev;
+            _header.prev->next = &_header;
+            _header.parent = lo;
+            lo->parent = &_header;
+            _size() -= moved;
+
+            first->prev = &other._header;
+            last->next = &other._header;
+            other._header.next = first;
+            other._header.prev = last;
+            other._header.parent = hi;
+            hi->parent = &other._header;
+            other._size() = moved;
+            return other;
+        }
+
+        /* Moves every element of other, whose keys must all go after the
+         * keys of the container, to the end of the container in O(log n),
+         * or O(other.size()) if other is compacted.
+         */
+        void join(map &other)
+        {
+            if (&other == this || other.empty())
+                return ;
+            if (empty()) {
+                swap(other);
+                return ;
+            }
+            assert(_less(_key(_header.prev), _key(other._header.next)));
+            other._release_slab();
+
+            rb_node_base    *k = rb_erase_and_rebalance<Policy>(other._header.next, other._header);
+            rb_node_base    *l = _header.parent;
+            rb_node_base    *r = other._header.parent;
+            size_type       height;
+
+            l->parent = 0;
+            if (r)
+                r->parent = 0;
+            _header.parent = rb_join<Policy>(
+                l, rb_black_height(l), k, r, rb_black_height(r), height);
+            _header.parent->parent = &_header;
+
+            rb_link_before(k, &_header);
+            if (r) {
+                k->next = other._header.next;
+                k->next->prev = k;
+                _header.prev = other._header.prev;
+                _header.prev->next = &_header;
+            }
+            /* the size of other still counts k */
+            _size() += other._size();
+            other._reset();
+        }
+
+        /* Unlinks the element at position and returns the node that holds
+         * it. Nothing is copied or deallocated, unless the element is in the
+         * block of compact().
+         */
+        node_type extract(const_iterator position)
+        {
+            assert(position != end());
+
+            rb_node_base *x = const_cast<rb_node_base *>(position.node());
+
+            if (_in_slab(x))
+                x = _copy_out(x);
+            rb_erase_and_rebalance<Policy>(x, _header);
+            --_size();
+            return node_type(static_cast<tree_node *>(x), _allocator());
+        }
+
+        /* Same as above for the element with key k. The returned handle is
+         * empty if there is no such element.
+         */
+        node_type extract(key_type const &k)
+        {
+            iterator it = find(k);
+
+            if (it == end())
+                return node_type();
+            return extract(const_iterator(it));
+        }
+
+        /* Links the node owned by nh into the map if its key is not in the
+         * map yet. Nothing is allocated or copied. The node must come from
+         * a map with an equal allocator.
+         */
+        insert_return_type insert(node_type nh)
+        {
+            insert_return_type  ret;
+            rb_node_base        *parent;
+            bool                left;
+
+            ret.inserted = false;
+            if (nh.empty()) {
+                ret.position = end();
+                return ret;
+            }
+            assert(nh.get_allocator() == _allocator());
+
+            rb_node_base *same = _insert_position(nh.key(), parent, left);
+
+            if (same) {
+                ret.position = iterator(same);
+                ret.node = nh;
+                return ret;
+            }
+
+            tree_node *n = nh.release();
+
+            rb_insert_and_rebalance<Policy>(left, n, parent, _header);
+            ++_size();
+            ret.position = iterator(n);
+            ret.inserted = true;
+            return ret;
+        }
+
+        template <class K, class V, class C, class A, class P, class R>
+        friend map<K, V, C, A, P, R> set_union(
+            map<K, V, C, A, P, R> const &x, map<K, V, C, A, P, R> const &y);
+
+        template <class K, class V, class C, class A, class P, class R>
+        friend map<K, V, C, A, P, R> set_intersection(
+            map<K, V, C, A, P, R> const &x, map<K, V, C, A, P, R> const &y);
+
+        template <class K, class V, class C, class A, class P, class R>
+        friend map<K, V, C, A, P, R> set_difference(
+            map<K, V, C, A, P, R> const &x, map<K, V, C, A, P, R> const &y);
 
 	/*------------------------------------------------------------*/
 	/*--- Observers                                            ---*/
@@ -161,12 +712,18 @@ class map {
         /* Returns a copy of the comparison object used by the container
          * to compare keys.
          */
-        key_compare key_comp(void) const;
+        key_compare key_comp(void) const { return _comp(); }
 
         /* Returns a comparison object that can be used to compare two elements to
          * get whether the key of the first one goes before the second.
          */
-        value_compare value_comp(void) const;
+        value_compare value_comp(void) const { return value_compare(_comp()); }
+
+        /* Returns the trace policy object of the map, which holds its
+         * counts with operation_trace.
+         */
+        Trace       &trace(void)        { return _trace(); }
+        Trace const &trace(void) const  { return _trace(); }
 
 	/*------------------------------------------------------------*/
 	/*--- Operations                                           ---*/
@@ -176,37 +733,775 @@ class map {
          * returns an iterator to it if found, otherwise it returns an
          * iterator to map::end.
          */
-        iterator 		find(key_type const &k);
-        const_iterator	find(key_type const &k) const;
+        iterator find(key_type const &k) { return iterator(_find(k)); }
+        const_iterator find(key_type const &k) const { return const_iterator(_find(k)); }
 
         /* Searches the container for elements with a key equivalent to k
          * and returns the number of matches.
          */
-        size_type count(key_type const &k) const;
+        size_type count(key_type const &k) const { return _find(k) != &_header; }
 
         /* Returns an iterator pointing to the first element in the container whose
          * key is not considered to go before k (i.e., either it is equivalent or
          * goes after).
          */
-        iterator		lower_bound(key_type const &k);
-        const_iterator	lower_bound(key_type const &k) const;
+        iterator		lower_bound(key_type const &k)         { return iterator(_lower_bound(k)); }
+        const_iterator	lower_bound(key_type const &k) const   { return const_iterator(_lower_bound(k)); }
 
         /* Returns an iterator pointing to the first element in the container
          * whose key is considered to go after k.
          */
-        iterator		upper_bound(key_type const &k);
-        const_iterator	upper_bound(key_type const &k) const;
+        iterator		upper_bound(key_type const &k)         { return iterator(_upper_bound(k)); }
+        const_iterator	upper_bound(key_type const &k) const   { return const_iterator(_upper_bound(k)); }
+
+        pair<const_iterator,const_iterator> equal_range(key_type const &k) const
+        { return ft::make_pair(lower_bound(k), upper_bound(k)); }
 
-        pair<const_iterator,const_iterator>	equal_range(key_type const &k) const;
-        pair<iterator,iterator>				equal_range(key_type const &k);
+        pair<iterator,iterator> equal_range(key_type const &k)
+        { return ft::make_pair(lower_bound(k), upper_bound(k)); }
+
+        /* The same lookups with a key of another type, which is compared
+         * with the keys of the map as is, without building a key_type.
+         * They only take part in overload resolution when key_compare is
+         * transparent, such as ft::less<void>.
+         */
+        template <class K>
+        iterator find(
+            K const &k,
+            typename ft::enable_if< ft::is_transparent<Compare, K>::value >::type* = 0)
+        { return iterator(_find(k)); }
+
+        template <class K>
+        const_iterator find(
+            K const &k,
+            typename ft::enable_if< ft::is_transparent<Compare, K>::value >::type* = 0) const
+        { return const_iterator(_find(k)); }
+
+        template <class K>
+        size_type count(
+            K const &k,
+            typename ft::enable_if< ft::is_transparent<Compare, K>::value >::type* = 0) const
+        { return _find(k) != &_header; }
+
+        template <class K>
+        iterator lower_bound(
+            K const &k,
+            typename ft::enable_if< ft::is_transparent<Compare, K>::value >::type* = 0)
+        { return iterator(_lower_bound(k)); }
+
+        template <class K>
+        const_iterator lower_bound(
+            K const &k,
+            typename ft::enable_if< ft::is_transparent<Compare, K>::value >::type* = 0) const
+        { return const_iterator(_lower_bound(k)); }
+
+        template <class K>
+        iterator upper_bound(
+            K const &k,
+            typename ft::enable_if< ft::is_transparent<Compare, K>::value >::type* = 0)
+        { return iterator(_upper_bound(k)); }
+
+        template <class K>
+        const_iterator upper_bound(
+            K const &k,
+            typename ft::enable_if< ft::is_transparent<Compare, K>::value >::type* = 0) const
+        { return const_iterator(_upper_bound(k)); }
+
+        template <class K>
+        pair<iterator,iterator> equal_range(
+            K const &k,
+            typename ft::enable_if< ft::is_transparent<Compare, K>::value >::type* = 0)
+        { return ft::make_pair(iterator(_lower_bound(k)), iterator(_upper_bound(k))); }
+
+        template <class K>
+        pair<const_iterator,const_iterator> equal_range(
+            K const &k,
+            typename ft::enable_if< ft::is_transparent<Compare, K>::value >::type* = 0) const
+        { return ft::make_pair(const_iterator(_lower_bound(k)), const_iterator(_upper_bound(k))); }
+
+	/*------------------------------------------------------------*/
+	/*--- Batched lookup                                       ---*/
+	/*------------------------------------------------------------*/
+
+        /* Writes find(k) to out for every key k of [first, last), in order.
+         * Up to batch_width descents are interleaved and the next node of
+         * each one is prefetched, so the cache misses of different keys
+         * overlap instead of being paid one after the other. Sorted keys
+         * are descended from the root too: the levels their paths share
+         * stay in the cache, and starting from the previous result would
+         * make each descent wait for the one before it.
+         */
+        template <class ForwardIterator, class OutputIterator>
+        OutputIterator find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out)
+        { return _batch<iterator>(first, last, out, true); }
+
+        template <class ForwardIterator, class OutputIterator>
+        OutputIterator find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+        { return _batch<const_iterator>(first, last, out, true); }
+
+        /* Writes lower_bound(k) to out for every key k of [first, last). */
+        template <class ForwardIterator, class OutputIterator>
+        OutputIterator lower_bound_batch(ForwardIterator first, ForwardIterator last, OutputIterator out)
+        { return _batch<iterator>(first, last, out, false); }
+
+        template <class ForwardIterator, class OutputIterator>
+        OutputIterator lower_bound_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+        { return _batch<const_iterator>(first, last, out, false); }
+
+	/*------------------------------------------------------------*/
+	/*--- Order statistics                                     ---*/
+	/*------------------------------------------------------------*/
+
+        /* These require Policy = order_statistics and run in O(log n). */
+
+        /* Returns an iterator to the element at index n in key order,
+         * or end() if n >= size().
+         */
+        iterator        nth(size_type n)        { return iterator(_nth(n)); }
+        const_iterator  nth(size_type n) const  { return const_iterator(_nth(n)); }
+
+        /* Returns the number of elements whose key goes before k. */
+        size_type rank(key_type const &k) const
+        {
+            rb_node_base const  *x = _header.parent;
+            size_type           r = 0;
+
+            while (x) {
+                if (_less(_key(x), k)) {
+                    r += Policy::size(x->left) + 1;
+                    x = x->right;
+                } else
+                    x = x->left;
+            }
+            return r;
+        }
+
+        /* Returns the index of the element at position in key order,
+         * or size() for end().
+         */
+        size_type index_of(const_iterator position) const
+        {
+            rb_node_base const *x = position.node();
+
+            if (x == &_header)
+                return _size();
+
+            size_type r = Policy::size(x->left);
+
+            for (; x->parent != &_header; x = x->parent) {
+                if (x == x->parent->right)
+                    r += Policy::size(x->parent->left) + 1;
+            }
+            return r;
+        }
+
+        /* Returns the number of increments from first to last. */
+        difference_type distance(const_iterator first, const_iterator last) const
+        {
+            return static_cast<difference_type>(index_of(last))
+                - static_cast<difference_type>(index_of(first));
+        }
 
 	/*------------------------------------------------------------*/
 	/*--- Allocator                                            ---*/
 	/*------------------------------------------------------------*/
 
-        allocator_type get_allocator(void) const;
+        allocator_type get_allocator(void) const { return _allocator(); }
+
+	/*------------------------------------------------------------*/
+	/*--- Tree                                                 ---*/
+	/*------------------------------------------------------------*/
+
+    private:
+        static key_type const &_key(rb_node_base const *x)
+        { return static_cast<tree_node const *>(x)->value.first; }
+
+        /* Either side may be a key of another type, for the lookups of
+         * a transparent comparator; it is passed on as it is.
+         */
+        template <class A, class B>
+        bool _less(A const &a, B const &b) const
+        {
+            _trace().compare();
+            return _comp()(a, b);
+        }
+
+        void _reset(void)
+        {
+            _header.color = rb_red;
+            _header.parent = 0;
+            _header.left = 0;
+            _header.right = 0;
+            _header.next = &_header;
+            _header.prev = &_header;
+            _size() = 0;
+        }
+
+        /* The root and both ends of the list point back to the header,
+         * which must be updated when the header moves to another map.
+         */
+        void _fix_header(void)
+        {
+            if (_header.parent) {
+                _header.parent->parent = &_header;
+                _header.next->prev = &_header;
+                _header.prev->next = &_header;
+            } else
+                _reset();
+        }
+
+        tree_node *_create_node(value_type const &val)
+        {
+            tree_node *n = _node_allocator().allocate(1);
+
+            _trace().allocate();
+            try {
+                _allocator().construct(&n->value, val);
+            } catch (...) {
+                _node_allocator().deallocate(n, 1);
+                throw ;
+            }
+            _trace().copy();
+            return n;
+        }
+
+        void _destroy_node(rb_node_base *x)
+        {
+            tree_node *n = static_cast<tree_node *>(x);
+
+            _allocator().destroy(&n->value);
+            _trace().destroy();
+            if (!_in_slab(n))
+                _node_allocator().deallocate(n, 1);
+            else if (!--_slab_header().live)
+                _free_slab();
+        }
+
+        /* The block of nodes laid out by compact(), 0 if there is none.
+         * The tree algorithms leave the left link of the header unused,
+         * so the pointer costs nothing to maps that never compact.
+         */
+        tree_node   *_slab(void) const              { return static_cast<tree_node *>(_header.left); }
+        void        _set_slab(tree_node *slab)      { _header.left = slab; }
+
+        /* What the first node of the slab holds instead of an element;
+         * the elements come after it.
+         */
+        struct slab_header
+        {
+            size_type   capacity;   /* nodes allocated, this one included */
+            size_type   live;       /* elements not destroyed yet */
+        };
+
+        slab_header &_slab_header(void) const { return *reinterpret_cast<slab_header *>(_slab()); }
+
+        bool _in_slab(rb_node_base const *x) const
+        {
+            tree_node const *n = static_cast<tree_node const *>(x);
+            tree_node const *slab = _slab();
+
+            return slab && n > slab && n < slab + _slab_header().capacity;
+        }
+
+        /* Frees the slab, whose elements must all be destroyed. */
+        void _free_slab(void)
+        {
+            _node_allocator().deallocate(_slab(), _slab_header().capacity);
+            _set_slab(0);
+        }
+
+        /* Links n, which holds the element of x, in place of x. */
+        void _replace_node(rb_node_base *x, rb_node_base *n)
+        {
+            static_cast<node_base &>(*n) = static_cast<node_base &>(*x);
+            if (x->parent == &_header)
+                _header.parent = n;
+            else if (x->parent->left == x)
+                x->parent->left = n;
+            else
+                x->parent->right = n;
+            if (n->left)
+                n->left->parent = n;
+            if (n->right)
+                n->right->parent = n;
+            n->next->prev = n;
+            n->prev->next = n;
+        }
+
+        /* Puts a copy of the element of the slab node x in a node of its
+         * own, in place of x, and returns it.
+         */
+        rb_node_base *_copy_out(rb_node_base *x)
+        {
+            rb_node_base *n = _create_node(static_cast<tree_node *>(x)->value);
+
+            _replace_node(x, n);
+            _destroy_node(x);
+            return n;
+        }
+
+        /* Gives every element in the slab a node of its own, so that the
+         * nodes can move to another map, and frees the slab.
+         */
+        void _release_slab(void)
+        {
+            for (rb_node_base *x = _header.next; _slab() && x != &_header; x = x->next)
+                if (_in_slab(x))
+                    x = _copy_out(x);
+        }
+
+        void _destroy_tree(rb_node_base *x)
+        {
+            while (x) {
+                rb_node_base *left = x->left;
+
+                _destroy_tree(x->right);
+                _destroy_node(x);
+                x = left;
+            }
+        }
+
+        /* Finds where a node with key k would be linked. Returns the node
+         * with an equivalent key if there is one, 0 otherwise.
+         */
+        rb_node_base *_insert_position(key_type const &k, rb_node_base *&parent, bool &left)
+        {
+            rb_node_base *x = _header.parent;
+
+            parent = &_header;
+            left = true;
+            while (x) {
+                parent = x;
+                left = _less(k, _key(x));
+                x = left ? x->left : x->right;
+            }
+
+            rb_node_base *before = parent;
+
+            if (left) {
+                if (parent == _header.next)
+                    return 0;
+                before = rb_decrement(parent);
+            }
+            if (_less(_key(before), k))
+                return 0;
+            return before;
+        }
+
+        iterator _insert_at(bool left, rb_node_base *parent, value_type const &val)
+        {
+            tree_node *n = _create_node(val);
+
+            rb_insert_and_rebalance<Policy>(left, n, parent, _header);
+            ++_size();
+            return iterator(n);
+        }
+
+        /* Splits the subtree x, whose black height is h and whose root has
+         * no parent, into the nodes with a key less than k (lo) and the
+         * others (hi). Each level joins one node to a piece whose black
+         * height is at most the one of the level below, so the joins add
+         * up to O(h).
+         */
+        void _split(
+            rb_node_base *x,
+            size_type h,
+            key_type const &k,
+            rb_node_base *&lo,
+            size_type &lo_height,
+            rb_node_base *&hi,
+            size_type &hi_height) const
+        {
+            if (!x) {
+                lo = 0;
+                hi = 0;
+                lo_height = 0;
+                hi_height = 0;
+                return ;
+            }
+
+            rb_node_base    *left = x->left;
+            rb_node_base    *right = x->right;
+            size_type       child_height = h - (x->color == rb_black);
+
+            if (left)
+                left->parent = 0;
+            if (right)
+                right->parent = 0;
+            if (_less(_key(x), k)) {
+                _split(right, child_height, k, lo, lo_height, hi, hi_height);
+                lo = rb_join<Policy>(left, child_height, x, lo, lo_height, lo_height);
+            } else {
+                _split(left, child_height, k, lo, lo_height, hi, hi_height);
+                hi = rb_join<Policy>(hi, hi_height, x, right, child_height, hi_height);
+            }
+        }
+
+        /* Counts the nodes from first to the end of the list, walking from
+         * first in both directions so that only the smaller side is visited.
+         */
+        size_type _count_from(rb_node_base const *first) const
+        {
+            rb_node_base const  *after = first;
+            rb_node_base const  *before = first->prev;
+            size_type           n = 0;
+
+            for (;;) {
+                if (after == &_header)
+                    return n;
+                if (before == &_header)
+                    return _size() - n;
+                after = after->next;
+                before = before->prev;
+                ++n;
+            }
+        }
+
+        /* Copies the subtree x under parent, keeping its shape and colors.
+         * The copies are appended to the list in order.
+         */
+        rb_node_base *_copy_tree(rb_node_base const *x, rb_node_base *parent)
+        {
+            if (!x)
+                return 0;
+
+            rb_node_base *n = _create_node(static_cast<tree_node const *>(x)->value);
+
+            n->color = x->color;
+            n->parent = parent;
+            n->left = 0;
+            n->right = 0;
+            try {
+                n->left = _copy_tree(x->left, n);
+                rb_link_before(n, &_header);
+                n->right = _copy_tree(x->right, n);
+            } catch (...) {
+                _destroy_tree(n);
+                throw ;
+            }
+            Policy::update(n);
+            return n;
+        }
+
+        void _copy_from(map const &x)
+        {
+            if (!x._header.parent)
+                return ;
+            try {
+                _header.parent = _copy_tree(x._header.parent, &_header);
+            } catch (...) {
+                _reset();
+                throw ;
+            }
+            _size() = x._size();
+        }
+
+        /* Links nodes[lo, hi) into a perfectly balanced subtree. The nodes
+         * on the deepest level are red when it is not the root level, so
+         * every path holds the same number of black nodes.
+         */
+        static rb_node_base *_build_tree(
+            rb_node_base *const *nodes,
+            size_type lo,
+            size_type hi,
+            rb_node_base *parent,
+            size_type depth,
+            size_type red_depth)
+        {
+            if (lo == hi)
+                return 0;
+
+            size_type       mid = lo + (hi - lo) / 2;
+            rb_node_base    *n = nodes[mid];
+
+            n->parent = parent;
+            n->color = (depth && depth == red_depth) ? rb_red : rb_black;
+            n->left = _build_tree(nodes, lo, mid, n, depth + 1, red_depth);
+            n->right = _build_tree(nodes, mid + 1, hi, n, depth + 1, red_depth);
+            Policy::update(n);
+            return n;
+        }
+
+        /* Makes the tree out of the n nodes, which are sorted by key and
+         * not linked to any other tree. This is O(n). The nodes may still
+         * be in the block of compact(), which the map keeps.
+         */
+        void _build(rb_node_base *const *nodes, size_type n)
+        {
+            tree_node   *slab = _slab();
+            size_type   depth = 0;
+
+            _reset();
+            _set_slab(slab);
+            if (!n)
+                return ;
+            while ((n >> depth) > 1)
+                ++depth;
+            _header.parent = _build_tree(nodes, 0, n, &_header, 0, depth);
+            for (size_type i = 0; i < n; ++i)
+                rb_link_before(nodes[i], &_header);
+            _size() = n;
+        }
+
+        enum set_operation { set_op_union, set_op_intersection, set_op_difference };
+
+        /* Builds the result of a set operation on the keys of x and y in
+         * O(x.size() + y.size()). The values are copied from x, or from y
+         * for keys that are only in y.
+         */
+        void _assign_set_operation(map const &x, map const &y, set_operation op)
+        {
+            ft::vector<rb_node_base *>  nodes;
+            rb_node_base const          *a = x._header.next;
+            rb_node_base const          *b = y._header.next;
+            rb_node_base const          *a_end = &x._header;
+            rb_node_base const          *b_end = &y._header;
+
+            /* push_back must not throw once a node is made, or the node is lost */
+            nodes.reserve(op == set_op_union ? x.size() + y.size() : x.size());
+            try {
+                while (a != a_end) {
+                    bool from_a;
+
+                    if (b == b_end || _less(_key(a), _key(b))) {
+                        from_a = (op != set_op_intersection);
+                    } else if (_less(_key(b), _key(a))) {
+                        if (op == set_op_union)
+                            nodes.push_back(_create_node(_value(b)));
+                        b = rb_increment(const_cast<rb_node_base *>(b));
+                        continue ;
+                    } else {
+                        from_a = (op != set_op_difference);
+                        b = rb_increment(const_cast<rb_node_base *>(b));
+                    }
+                    if (from_a)
+                        nodes.push_back(_create_node(_value(a)));
+                    a = rb_increment(const_cast<rb_node_base *>(a));
+                }
+                for (; op == set_op_union && b != b_end; b = rb_increment(const_cast<rb_node_base *>(b)))
+                    nodes.push_back(_create_node(_value(b)));
+            } catch (...) {
+                for (size_type i = 0; i < nodes.size(); ++i)
+                    _destroy_node(nodes[i]);
+                throw ;
+            }
+            _build(nodes.data(), nodes.size());
+        }
+
+        static value_type const &_value(rb_node_base const *x)
+        { return static_cast<tree_node const *>(x)->value; }
+
+        template <class K>
+        rb_node_base *_lower_bound(K const &k) const
+        {
+            rb_node_base const *x = _header.parent;
+            rb_node_base const *y = &_header;
+
+            while (x) {
+                if (!_less(_key(x), k)) {
+                    y = x;
+                    x = x->left;
+                } else
+                    x = x->right;
+            }
+            return const_cast<rb_node_base *>(y);
+        }
+
+        template <class K>
+        rb_node_base *_upper_bound(K const &k) const
+        {
+            rb_node_base const *x = _header.parent;
+            rb_node_base const *y = &_header;
+
+            while (x) {
+                if (_less(k, _key(x))) {
+                    y = x;
+                    x = x->left;
+                } else
+                    x = x->right;
+            }
+            return const_cast<rb_node_base *>(y);
+        }
+
+        template <class K>
+        rb_node_base *_find(K const &k) const
+        {
+            rb_node_base *y = _lower_bound(k);
+
+            if (y == &_header || _less(k, _key(y)))
+                return const_cast<rb_node_base *>(static_cast<rb_node_base const *>(&_header));
+            return y;
+        }
+
+        /* Number of descents interleaved by find_batch and lower_bound_batch. */
+        enum { batch_width = 8 };
+
+        static void _prefetch(rb_node_base const *x)
+        {
+            __builtin_prefetch(x);
+            __builtin_prefetch(&_key(x));
+        }
+
+        template <class Iterator, class ForwardIterator, class OutputIterator>
+        OutputIterator _batch(
+            ForwardIterator first,
+            ForwardIterator last,
+            OutputIterator out,
+            bool exact) const
+        {
+            rb_node_base const  *header = &_header;
+            ForwardIterator     keys[batch_width];
+            rb_node_base const  *x[batch_width];
+            rb_node_base const  *y[batch_width];
+
+            while (first != last) {
+                int n = 0;
+
+                for (; n < batch_width && first != last; ++n, ++first) {
+                    keys[n] = first;
+                    x[n] = _header.parent;
+                    y[n] = header;
+                    if (x[n])
+                        _prefetch(x[n]);
+                }
+
+                /* each pass moves every unfinished descent one level down */
+                for (int active = n; active; ) {
+                    active = 0;
+                    for (int i = 0; i < n; ++i) {
+                        if (!x[i])
+                            continue ;
+                        if (!_less(_key(x[i]), *keys[i])) {
+                            y[i] = x[i];
+                            x[i] = x[i]->left;
+                        } else
+                            x[i] = x[i]->right;
+                        if (x[i]) {
+                            _prefetch(x[i]);
+                            ++active;
+                        }
+                    }
+                }
+
+                for (int i = 0; i < n; ++i) {
+                    if (exact && y[i] != header && _less(*keys[i], _key(y[i])))
+                        y[i] = header;
+                    *out++ = Iterator(y[i]);
+                }
+            }
+            return out;
+        }
+
+        rb_node_base *_nth(size_type n) const
+        {
+            rb_node_base const *x = _header.parent;
+
+            if (n >= _size())
+                return const_cast<node_base *>(&_header);
+            while (x) {
+                size_type left = Policy::size(x->left);
+
+                if (n < left)
+                    x = x->left;
+                else if (n == left)
+                    break ;
+                else {
+                    n -= left + 1;
+                    x = x->right;
+                }
+            }
+            return const_cast<rb_node_base *>(x);
+        }
 };
 
+/*------------------------------------------------------------*/
+/*--- Non member functions                                 ---*/
+/*------------------------------------------------------------*/
+
+template <class Key, class T, class Compare, class Allocator, class Policy, class Trace>
+bool operator==(
+    map<Key, T, Compare, Allocator, Policy, Trace> const &x,
+    map<Key, T, Compare, Allocator, Policy, Trace> const &y)
+{
+    return x.size() == y.size()
+        && ft::equal(x.begin(), x.end(), y.begin());
+}
+
+template <class Key, class T, class Compare, class Allocator, class Policy, class Trace>
+bool operator!=(
+    map<Key, T, Compare, Allocator, Policy, Trace> const &x,
+    map<Key, T, Compare, Allocator, Policy, Trace> const &y) { return !(x == y); }
+
+template <class Key, class T, class Compare, class Allocator, class Policy, class Trace>
+bool operator<(
+    map<Key, T, Compare, Allocator, Policy, Trace> const &x,
+    map<Key, T, Compare, Allocator, Policy, Trace> const &y)
+{
+    return ft::lexicographical_compare(
+        x.begin(), x.end(),
+        y.begin(), y.end());
+}
+
+template <class Key, class T, class Compare, class Allocator, class Policy, class Trace>
+bool operator>(
+    map<Key, T, Compare, Allocator, Policy, Trace> const &x,
+    map<Key, T, Compare, Allocator, Policy, Trace> const &y) { return y < x; }
+
+template <class Key, class T, class Compare, class Allocator, class Policy, class Trace>
+bool operator<=(
+    map<Key, T, Compare, Allocator, Policy, Trace> const &x,
+    map<Key, T, Compare, Allocator, Policy, Trace> const &y) { return !(y < x); }
+
+template <class Key, class T, class Compare, class Allocator, class Policy, class Trace>
+bool operator>=(
+    map<Key, T, Compare, Allocator, Policy, Trace> const &x,
+    map<Key, T, Compare, Allocator, Policy, Trace> const &y) { return !(x < y); }
+
+/* Returns the elements whose key is in x or in y. */
+template <class Key, class T, class Compare, class Allocator, class Policy, class Trace>
+map<Key, T, Compare, Allocator, Policy, Trace> set_union(
+    map<Key, T, Compare, Allocator, Policy, Trace> const &x,
+    map<Key, T, Compare, Allocator, Policy, Trace> const &y)
+{
+    map<Key, T, Compare, Allocator, Policy, Trace> result(x.key_comp(), x.get_allocator());
+
+    result._assign_set_operation(x, y, result.set_op_union);
+    return result;
+}
+
+/* Returns the elements of x whose key is also in y. */
+template <class Key, class T, class Compare, class Allocator, class Policy, class Trace>
+map<Key, T, Compare, Allocator, Policy, Trace> set_intersection(
+    map<Key, T, Compare, Allocator, Policy, Trace> const &x,
+    map<Key, T, Compare, Allocator, Policy, Trace> const &y)
+{
+    map<Key, T, Compare, Allocator, Policy, Trace> result(x.key_comp(), x.get_allocator());
+
+    result._assign_set_operation(x, y, result.set_op_intersection);
+    return result;
+}
+
+/* Returns the elements of x whose key is not in y. */
+template <class Key, class T, class Compare, class Allocator, class Policy, class Trace>
+map<Key, T, Compare, Allocator, Policy, Trace> set_difference(
+    map<Key, T, Compare, Allocator, Policy, Trace> const &x,
+    map<Key, T, Compare, Allocator, Policy, Trace> const &y)
+{
+    map<Key, T, Compare, Allocator, Policy, Trace> result(x.key_comp(), x.get_allocator());
+
+    result._assign_set_operation(x, y, result.set_op_difference);
+    return result;
+}
+
+template <class Key, class T, class Compare, class Allocator, class Policy, class Trace>
+void swap(
+    map<Key, T, Compare, Allocator, Policy, Trace> &x,
+    map<Key, T, Compare, Allocator, Policy, Trace> &y) { x.swap(y); }
+
+/* A map with a stateless comparator and allocator is its header and its size. */
+typedef char map_size_check[
+    sizeof(static_assertion<sizeof(map<int, int>) == sizeof(rb_node_base) + sizeof(size_t)>)];
+
 } /* namespace: ft */
 
 #endif /* __MAP_HPP__ */
@@ -0,0 +1,119 @@
+/* page_allocator.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __PAGE_ALLOCATOR_HPP__
+# define __PAGE_ALLOCATOR_HPP__
+
+# include <new>
+# include <stddef.h>
+# include <unistd.h>
+# include <sys/mman.h>
+
+namespace ft
+{
+
+/* Blocks of at least this many bytes are mapped from the kernel. */
+enum { page_allocator_threshold = 1 << 20 };
+
+/* Stateless allocator for large arrays, such as the storage of a
+ * multi-gigabyte ft::vector.
+ *
+ * Blocks of page_allocator_threshold bytes or more are anonymous
+ * mappings, rounded up to whole pages; smaller ones come from operator
+ * new. A mapped block can grow with try_expand, which on Linux asks
+ * mremap to move its pages: the kernel edits the page tables and copies
+ * no data, and the old and new blocks never take room at the same time.
+ * ft::vector grows with it when its elements are trivially relocatable.
+ */
+template <class T>
+class page_allocator
+{
+	public:
+		typedef T				value_type;
+		typedef T				*pointer;
+		typedef T const			*const_pointer;
+		typedef T				&reference;
+		typedef T const			&const_reference;
+		typedef size_t			size_type;
+		typedef ptrdiff_t		difference_type;
+
+		template <class U>
+		struct rebind { typedef page_allocator<U> other; };
+
+		page_allocator(void) { }
+		page_allocator(page_allocator const &) { }
+		template <class U>
+		page_allocator(page_allocator<U> const &) { }
+
+		pointer			address(reference x) const			{ return &x; }
+		const_pointer	address(const_reference x) const	{ return &x; }
+
+		size_type max_size(void) const { return size_type(-1) / sizeof(T); }
+
+		pointer allocate(size_type n, void const * = 0)
+		{
+			if (n > max_size())
+				throw std::bad_alloc();
+			if (!_mapped(n))
+				return static_cast<pointer>(::operator new(n * sizeof(T)));
+
+			void *p = mmap(0, _length(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+			if (p == MAP_FAILED)
+				throw std::bad_alloc();
+			return static_cast<pointer>(p);
+		}
+
+		void deallocate(pointer p, size_type n)
+		{
+			if (_mapped(n))
+				munmap(p, _length(n));
+			else
+				::operator delete(p);
+		}
+
+		/* Grows the block p of n objects to new_n objects, keeping its
+		 * bytes. Returns the block, which may have moved, or 0 if it
+		 * could not grow this way; p is then left as it was.
+		 */
+		pointer try_expand(pointer p, size_type n, size_type new_n)
+		{
+			if (!_mapped(n) || new_n > max_size())
+				return 0;
+			if (_length(new_n) == _length(n))
+				return p;
+#ifdef MREMAP_MAYMOVE
+			void *q = mremap(p, _length(n), _length(new_n), MREMAP_MAYMOVE);
+
+			return q == MAP_FAILED ? 0 : static_cast<pointer>(q);
+#else
+			return 0;
+#endif
+		}
+
+		void construct(pointer p, const_reference val)	{ new(p) T(val); }
+		void destroy(pointer p)							{ p->~T(); }
+
+	private:
+		static bool _mapped(size_type n) { return n * sizeof(T) >= page_allocator_threshold; }
+
+		/* Length of the mapping of a block of n objects. */
+		static size_t _length(size_type n)
+		{
+			size_t page = sysconf(_SC_PAGESIZE);
+
+			return (n * sizeof(T) + page - 1) / page * page;
+		}
+};
+
+template <class T, class U>
+bool operator==(page_allocator<T> const &, page_allocator<U> const &) { return true; }
+
+template <class T, class U>
+bool operator!=(page_allocator<T> const &, page_allocator<U> const &) { return false; }
+
+} /* namespace: ft */
+
+#endif /* __PAGE_ALLOCATOR_HPP__ */
@@ -0,0 +1,311 @@
+/* parallel.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __PARALLEL_HPP__
+# define __PARALLEL_HPP__
+
+# include "thread_pool.hpp"
+# include "rb_tree.hpp"
+# include "vector.hpp"
+# include <stddef.h>
+
+namespace ft
+{
+
+/* Default number of elements a task of a parallel algorithm handles: big
+ * enough that spawning it costs little next to running it.
+ */
+enum { parallel_grain = 4096 };
+
+/*------------------------------------------------------------*/
+/*--- Fork-join                                            ---*/
+/*------------------------------------------------------------*/
+
+/* The state shared by the tasks of a parallel algorithm. */
+struct parallel_job
+{
+	thread_pool	*pool;
+	size_t		pending;	/* tasks not done */
+
+	explicit parallel_job(thread_pool &p) : pool(&p), pending(0) { }
+};
+
+/* Runs the chunks [first,last) of Job: spawns the upper half of the
+ * range until one chunk is left, and runs that one.
+ */
+template <class Job>
+void parallel_split(void *p, size_t first, size_t last)
+{
+	Job *job = static_cast<Job *>(p);
+
+	while (last - first > 1) {
+		size_t		mid = first + (last - first) / 2;
+		pool_task	t = { parallel_split<Job>, job, mid, last };
+
+		__atomic_add_fetch(&job->pending, 1, __ATOMIC_RELAXED);
+		job->pool->spawn(t);
+		last = mid;
+	}
+	job->run(first);
+	thread_pool::done(job->pending);
+}
+
+/* Calls job.run(c) for every chunk c in [0,chunks), on the threads of the
+ * pool of the job, and returns when every call has returned.
+ */
+template <class Job>
+void parallel_run(Job &job, size_t chunks)
+{
+	if (!chunks)
+		return ;
+	if (job.pool->concurrency() == 1 || chunks == 1) {
+		for (size_t c = 0; c < chunks; ++c)
+			job.run(c);
+		return ;
+	}
+	job.pending = 1;
+	parallel_split<Job>(&job, 0, chunks);
+	job.pool->wait(job.pending);
+}
+
+/*------------------------------------------------------------*/
+/*--- Random access ranges                                 ---*/
+/*------------------------------------------------------------*/
+
+/* The algorithms below split [first,last), which must be made of random
+ * access iterators, into chunks of grain elements, and run the chunks on
+ * pool. The function objects are shared by all the threads and must not
+ * throw.
+ */
+
+template <class RandomIt, class UnaryFunction>
+struct parallel_for_each_job : parallel_job
+{
+	RandomIt		first;
+	size_t			size;
+	size_t			grain;
+	UnaryFunction	*f;
+
+	parallel_for_each_job(thread_pool &p) : parallel_job(p) { }
+
+	void run(size_t c)
+	{
+		RandomIt it = first + c * grain;
+		RandomIt end = first + (size - c * grain < grain ? size : (c + 1) * grain);
+
+		for (; it != end; ++it)
+			(*f)(*it);
+	}
+};
+
+/* Calls f on every element of [first,last), in no particular order. */
+template <class RandomIt, class UnaryFunction>
+void parallel_for_each(
+	RandomIt first,
+	RandomIt last,
+	UnaryFunction f,
+	size_t grain = parallel_grain,
+	thread_pool &pool = thread_pool::global())
+{
+	parallel_for_each_job<RandomIt, UnaryFunction> job(pool);
+
+	assert(grain);
+	job.first = first;
+	job.size = last - first;
+	job.grain = grain;
+	job.f = &f;
+	parallel_run(job, (job.size + grain - 1) / grain);
+}
+
+template <class RandomIt, class OutputIt, class UnaryOperation>
+struct parallel_transform_job : parallel_job
+{
+	RandomIt		first;
+	OutputIt		out;
+	size_t			size;
+	size_t			grain;
+	UnaryOperation	*op;
+
+	parallel_transform_job(thread_pool &p) : parallel_job(p) { }
+
+	void run(size_t c)
+	{
+		size_t		offset = c * grain;
+		RandomIt	it = first + offset;
+		RandomIt	end = first + (size - offset < grain ? size : offset + grain);
+		OutputIt	o = out + offset;
+
+		for (; it != end; ++it, ++o)
+			*o = (*op)(*it);
+	}
+};
+
+/* Stores op(x) for every element x of [first,last) in the range that
+ * starts at out, which must be random access too. Returns the end of the
+ * output range.
+ */
+template <class RandomIt, class OutputIt, class UnaryOperation>
+OutputIt parallel_transform(
+	RandomIt first,
+	RandomIt last,
+	OutputIt out,
+	UnaryOperation op,
+	size_t grain = parallel_grain,
+	thread_pool &pool = thread_pool::global())
+{
+	parallel_transform_job<RandomIt, OutputIt, UnaryOperation> job(pool);
+
+	assert(grain);
+	job.first = first;
+	job.out = out;
+	job.size = last - first;
+	job.grain = grain;
+	job.op = &op;
+	parallel_run(job, (job.size + grain - 1) / grain);
+	return out + job.size;
+}
+
+template <class RandomIt, class T, class BinaryOperation>
+struct parallel_reduce_job : parallel_job
+{
+	RandomIt			first;
+	size_t				size;
+	size_t				grain;
+	BinaryOperation		*op;
+	ft::vector<T>		partial;	/* the result of every chunk */
+
+	parallel_reduce_job(thread_pool &p) : parallel_job(p) { }
+
+	void run(size_t c)
+	{
+		RandomIt	it = first + c * grain;
+		RandomIt	end = first + (size - c * grain < grain ? size : (c + 1) * grain);
+		T			sum = *it;
+
+		while (++it != end)
+			sum = (*op)(sum, *it);
+		partial[c] = sum;
+	}
+};
+
+/* Returns init combined with every element of [first,last) by op, which
+ * must be associative: the chunks are summed in parallel, then the sums
+ * of the chunks in order.
+ */
+template <class RandomIt, class T, class BinaryOperation>
+T parallel_reduce(
+	RandomIt first,
+	RandomIt last,
+	T init,
+	BinaryOperation op,
+	size_t grain = parallel_grain,
+	thread_pool &pool = thread_pool::global())
+{
+	parallel_reduce_job<RandomIt, T, BinaryOperation> job(pool);
+	size_t chunks;
+
+	assert(grain);
+	job.first = first;
+	job.size = last - first;
+	job.grain = grain;
+	job.op = &op;
+	chunks = (job.size + grain - 1) / grain;
+	job.partial.assign(chunks, init);
+	parallel_run(job, chunks);
+	for (size_t c = 0; c < chunks; ++c)
+		init = op(init, job.partial[c]);
+	return init;
+}
+
+/*------------------------------------------------------------*/
+/*--- Ordered maps                                         ---*/
+/*------------------------------------------------------------*/
+
+template <class Node, class Value, class UnaryFunction>
+struct parallel_tree_job : parallel_job
+{
+	size_t			grain;
+	UnaryFunction	*f;
+
+	parallel_tree_job(thread_pool &p) : parallel_job(p) { }
+
+	/* Size of the subtree of n, exact if the nodes keep it. Otherwise
+	 * this is 2^bh, where bh is its black height: the subtree has at
+	 * least 2^bh - 1 nodes, and aiming higher split a map built in key
+	 * order into chunks sixteen times smaller than the grain.
+	 */
+	static size_t subtree_size(rb_node_base const *n)
+	{
+		size_t size;
+
+		if (!Node::policy_type::count(n, size))
+			size = size_t(1) << rb_black_height(n);
+		return size;
+	}
+
+	void visit(rb_node_base *n) { (*f)(*rb_tree_iterator<Node, Value>(n)); }
+};
+
+/* Runs f on the nodes [first,last) of a tree: while the subtree that
+ * holds the range is bigger than the grain, runs f on its root and
+ * spawns the part of the range after it.
+ */
+template <class Job>
+void parallel_split_tree(void *p, size_t first, size_t last)
+{
+	Job				*job = static_cast<Job *>(p);
+	rb_node_base	*x = reinterpret_cast<rb_node_base *>(first);
+	rb_node_base	*end = reinterpret_cast<rb_node_base *>(last);
+
+	while (x != end) {
+		rb_node_base *m = rb_split_point(x, end->prev);
+
+		if (Job::subtree_size(m) <= job->grain)
+			break ;
+		if (m->next != end) {
+			pool_task t = {
+				parallel_split_tree<Job>, job,
+				reinterpret_cast<size_t>(m->next), reinterpret_cast<size_t>(end) };
+
+			__atomic_add_fetch(&job->pending, 1, __ATOMIC_RELAXED);
+			job->pool->spawn(t);
+		}
+		job->visit(m);
+		end = m;
+	}
+	for (; x != end; x = x->next)
+		job->visit(x);
+	thread_pool::done(job->pending);
+}
+
+/* Calls f on every element of [first,last), a range of an ft::map, in no
+ * particular order. The range is split where the tree branches, so
+ * splitting costs O(log n) and needs no walk over the elements. Maps
+ * that keep order statistics are split into chunks of at most grain
+ * elements, others into chunks of about that size.
+ */
+template <class Node, class Value, class UnaryFunction>
+void parallel_for_each(
+	rb_tree_iterator<Node, Value> first,
+	rb_tree_iterator<Node, Value> last,
+	UnaryFunction f,
+	size_t grain = parallel_grain,
+	thread_pool &pool = thread_pool::global())
+{
+	typedef parallel_tree_job<Node, Value, UnaryFunction>	job_type;
+
+	job_type job(pool);
+
+	job.grain = grain;
+	job.f = &f;
+	job.pending = 1;
+	parallel_split_tree<job_type>(&job,
+		reinterpret_cast<size_t>(first.node()), reinterpret_cast<size_t>(last.node()));
+	pool.wait(job.pending);
+}
+
+} /* namespace: ft */
+
+#endif /* __PARALLEL_HPP__ */
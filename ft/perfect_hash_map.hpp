@@ -0,0 +1,346 @@
+/* perfect_hash_map.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __PERFECT_HASH_MAP_HPP__
+# define __PERFECT_HASH_MAP_HPP__
+
+# include "vector.hpp"
+# include "type_traits.hpp"
+# include <ostream>
+# include <stdexcept>
+# include <string.h>
+# include <stddef.h>
+# include <stdint.h>
+# include <assert.h>
+
+namespace ft
+{
+
+/*------------------------------------------------------------*/
+/*--- Key traits                                           ---*/
+/*------------------------------------------------------------*/
+
+/* How a perfect_hash_map hashes, compares and prints its keys. Defined
+ * for the integral types and for C strings (char const *).
+ */
+template <class Key, bool Integral = is_integral<Key>::value>
+struct perfect_hash_traits;
+
+/* Final mix of MurmurHash3: every bit of x changes about half of the
+ * bits of the result.
+ */
+inline uint64_t perfect_hash_mix(uint64_t x)
+{
+	x ^= x >> 33;
+	x *= 0xff51afd7ed558ccdULL;
+	x ^= x >> 33;
+	x *= 0xc4ceb9fe1a85ec53ULL;
+	x ^= x >> 33;
+	return x;
+}
+
+template <class Key>
+struct perfect_hash_traits<Key, true>
+{
+	static uint64_t hash(Key k, uint64_t seed)
+	{ return perfect_hash_mix(static_cast<uint64_t>(k) ^ seed); }
+
+	static bool equal(Key a, Key b) { return a == b; }
+
+	/* Suffixed, so that no value is too large for the type of its
+	 * literal. The minimum has no literal, its negation being too large.
+	 */
+	static void print(std::ostream &os, Key k)
+	{
+		long long const min = -0x7fffffffffffffffLL - 1;
+
+		if (Key(-1) > Key(0))
+			os << static_cast<unsigned long long>(k) << "ULL";
+		else if (static_cast<long long>(k) == min)
+			os << "(-9223372036854775807LL - 1)";
+		else
+			os << static_cast<long long>(k) << "LL";
+	}
+};
+
+template <>
+struct perfect_hash_traits<char const *, false>
+{
+	/* FNV-1a, then mixed */
+	static uint64_t hash(char const *s, uint64_t seed)
+	{
+		uint64_t h = 0xcbf29ce484222325ULL ^ seed;
+
+		for (; *s; ++s)
+			h = (h ^ static_cast<unsigned char>(*s)) * 0x100000001b3ULL;
+		return perfect_hash_mix(h);
+	}
+
+	static bool equal(char const *a, char const *b) { return !strcmp(a, b); }
+
+	static void print(std::ostream &os, char const *s)
+	{
+		static char const digits[] = "01234567";
+
+		os << '"';
+		for (; *s; ++s) {
+			unsigned char c = *s;
+
+			if (c == '"' || c == '\\')
+				os << '\\' << c;
+			else if (c >= ' ' && c < 127)
+				os << c;
+			else
+				os << '\\' << digits[c >> 6] << digits[c >> 3 & 7] << digits[c & 7];
+		}
+		os << '"';
+	}
+};
+
+/*------------------------------------------------------------*/
+/*--- Map                                                  ---*/
+/*------------------------------------------------------------*/
+
+/* Read-only map over a set of keys fixed at build time, with no
+ * collisions: find hashes the key once, reads the one element it can be
+ * and compares it once.
+ *
+ * The hash h of a key picks a bucket, h >> 32 modulo Buckets, and a slot,
+ * the low bits of h plus the displacement of the bucket modulo Slots. The
+ * seed and the displacements are chosen so that the keys fall in
+ * distinct slots, and index gives the element of each slot; the elements
+ * stay in the order they were given.
+ *
+ * The map is an aggregate whose members are all public, so a const map
+ * at namespace scope with a constant initializer is built by the
+ * compiler: no code runs at startup and nothing is allocated. T must then
+ * be an aggregate or a scalar too. perfect_hash_map_generate writes that
+ * initializer.
+ */
+template <
+	class Key,
+	class T,
+	size_t N,
+	size_t Slots,
+	size_t Buckets,
+	class Traits = perfect_hash_traits<Key> >
+struct perfect_hash_map
+{
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+	typedef Key					key_type;
+	typedef T					mapped_type;
+	typedef size_t				size_type;
+
+	struct value_type
+	{
+		Key	first;
+		T	second;
+	};
+
+	typedef value_type const	*const_iterator;
+
+	/*------------------------------------------------------------*/
+	/*--- Layout                                               ---*/
+	/*------------------------------------------------------------*/
+
+	value_type		elements[N];
+	uint64_t		seed;
+	unsigned short	displacement[Buckets];
+	unsigned short	index[Slots];	/* the element in every slot */
+
+	typedef char	_slots_check[sizeof(static_assertion<!(Slots & (Slots - 1))>)];
+
+	/*------------------------------------------------------------*/
+	/*--- Lookup                                               ---*/
+	/*------------------------------------------------------------*/
+
+	const_iterator	begin(void) const	{ return elements; }
+	const_iterator	end(void) const		{ return elements + N; }
+
+	bool		empty(void) const		{ return N == 0; }
+	size_type	size(void) const		{ return N; }
+
+	const_iterator find(key_type const &k) const
+	{
+		uint64_t		h = Traits::hash(k, seed);
+		size_t			slot = (static_cast<uint32_t>(h) + displacement[(h >> 32) % Buckets]) & (Slots - 1);
+		value_type const	*x = &elements[index[slot]];
+
+		return Traits::equal(x->first, k) ? x : end();
+	}
+
+	size_type count(key_type const &k) const { return find(k) != end(); }
+
+	/* Returns a reference to the mapped value of the element identified with key k. */
+	mapped_type const &at(key_type const &k) const
+	{
+		const_iterator it = find(k);
+
+		if (it == end())
+			throw std::out_of_range("key not found");
+		return it->second;
+	}
+};
+
+/*------------------------------------------------------------*/
+/*--- Generator                                            ---*/
+/*------------------------------------------------------------*/
+
+/* The seed, displacements and index of a perfect_hash_map over keys.
+ *
+ * There are about half as many buckets as keys, and Slots is the power
+ * of two that fits them all. The buckets are placed biggest first, each
+ * with the smallest displacement that puts all its keys in free slots;
+ * a bucket of one key always finds one. If two keys of a bucket fall on
+ * the same slot whatever the displacement, the next seed is tried.
+ */
+template <class Key, class Traits = perfect_hash_traits<Key> >
+struct perfect_hash_layout
+{
+	uint64_t					seed;
+	ft::vector<unsigned short>	displacement;
+	ft::vector<unsigned short>	index;
+
+	/* Returns false if the keys are not distinct, or too many. */
+	bool build(Key const *keys, size_t n)
+	{
+		size_t slots = 1;
+		size_t buckets = n / 2 ? n / 2 : 1;
+
+		while (slots < n)
+			slots *= 2;
+		if (!n || slots > 65536)
+			return false;
+		for (seed = 0; seed < 1000; ++seed) {
+			int placed = _place(keys, n, slots, buckets);
+
+			if (placed >= 0)
+				return placed;
+		}
+		return false;
+	}
+
+	private:
+		enum { _retry = -1, _duplicate = 0, _placed = 1 };
+
+		int _place(Key const *keys, size_t n, size_t slots, size_t buckets)
+		{
+			ft::vector<uint64_t>		hashes(n);
+			ft::vector<size_t>			start(buckets + 1, 0);	/* the keys of b are members[start[b], start[b + 1]) */
+			ft::vector<size_t>			members(n);
+			ft::vector<unsigned char>	used(slots, 0);
+			size_t						biggest = 0;
+
+			displacement.assign(buckets, 0);
+			index.assign(slots, 0);
+			for (size_t i = 0; i < n; ++i) {
+				hashes[i] = Traits::hash(keys[i], seed);
+				++start[_bucket(hashes[i], buckets) + 1];
+			}
+			for (size_t b = 0; b < buckets; ++b) {
+				if (start[b + 1] > biggest)
+					biggest = start[b + 1];
+				start[b + 1] += start[b];
+			}
+
+			ft::vector<size_t> end(start.begin(), start.end() - 1);
+
+			for (size_t i = 0; i < n; ++i)
+				members[end[_bucket(hashes[i], buckets)]++] = i;
+			for (size_t size = biggest; size > 0; --size) {
+				for (size_t b = 0; b < buckets; ++b) {
+					if (start[b + 1] - start[b] != size)
+						continue ;
+
+					int placed = _place_bucket(keys, hashes, &members[start[b]], size, b, used);
+
+					if (placed != _placed)
+						return placed;
+				}
+			}
+			return _placed;
+		}
+
+		int _place_bucket(Key const *keys, ft::vector<uint64_t> const &hashes,
+			size_t const *members, size_t size, size_t b, ft::vector<unsigned char> &used)
+		{
+			size_t mask = used.size() - 1;
+
+			for (size_t i = 0; i < size; ++i) {
+				for (size_t j = 0; j < i; ++j) {
+					if ((hashes[members[i]] & mask) != (hashes[members[j]] & mask))
+						continue ;
+					if (Traits::equal(keys[members[i]], keys[members[j]]))
+						return _duplicate;
+					return _retry;
+				}
+			}
+			for (size_t d = 0; d <= mask; ++d) {
+				size_t i = 0;
+
+				while (i < size && !used[(static_cast<uint32_t>(hashes[members[i]]) + d) & mask])
+					++i;
+				if (i < size)
+					continue ;
+				for (i = 0; i < size; ++i) {
+					size_t slot = (static_cast<uint32_t>(hashes[members[i]]) + d) & mask;
+
+					used[slot] = 1;
+					index[slot] = members[i];
+				}
+				displacement[b] = d;
+				return _placed;
+			}
+			return _retry;
+		}
+
+		static size_t _bucket(uint64_t h, size_t buckets) { return (h >> 32) % buckets; }
+};
+
+/* Writes to os the definition of a const perfect_hash_map called name
+ * that maps keys[i] to the C++ expression values[i], for a source file
+ * to compile. key_type and mapped_type are the names of the types.
+ * Returns false if the keys are not distinct, or more than 65536.
+ */
+template <class Key>
+bool perfect_hash_map_generate(
+	std::ostream &os,
+	char const *key_type,
+	char const *mapped_type,
+	char const *name,
+	Key const *keys,
+	char const *const *values,
+	size_t n)
+{
+	typedef perfect_hash_traits<Key>	traits;
+
+	perfect_hash_layout<Key>	layout;
+
+	if (!layout.build(keys, n))
+		return false;
+	os << "ft::perfect_hash_map<" << key_type << ", " << mapped_type << ", "
+		<< n << ", " << layout.index.size() << ", " << layout.displacement.size()
+		<< "> const " << name << " = {\n\t{\n";
+	for (size_t i = 0; i < n; ++i) {
+		os << "\t\t{ ";
+		traits::print(os, keys[i]);
+		os << ", " << values[i] << " }" << (i + 1 < n ? "," : "") << '\n';
+	}
+	os << "\t},\n\t" << layout.seed << ",\n\t{";
+	for (size_t b = 0; b < layout.displacement.size(); ++b)
+		os << (b ? ", " : " ") << layout.displacement[b];
+	os << " },\n\t{";
+	for (size_t s = 0; s < layout.index.size(); ++s)
+		os << (s ? ", " : " ") << layout.index[s];
+	os << " }\n};\n";
+	return true;
+}
+
+} /* namespace: ft */
+
+#endif /* __PERFECT_HASH_MAP_HPP__ */
@@ -0,0 +1,808 @@
+/* persistent_map.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __PERSISTENT_MAP_HPP__
+# define __PERSISTENT_MAP_HPP__
+
+# include "pair.hpp"
+# include "less.hpp"
+# include "iterator_traits.hpp"
+# include "reverse_iterator.hpp"
+# include "type_traits.hpp"
+# include <memory>
+# include <stdexcept>
+# include <stddef.h>
+# include <assert.h>
+
+namespace ft
+{
+
+/* Node of a persistent_map. Nodes are immutable once they are reachable
+ * from more than one root: the reference count tells whether a node is
+ * shared (refs > 1), in which case it is copied before being modified.
+ */
+template <typename Value>
+struct persistent_node
+{
+	persistent_node	*left;
+	persistent_node	*right;
+	size_t			refs;
+	int				height;
+	Value			value;
+};
+
+/* Bidirectional iterator over a persistent_map. Nodes have no parent
+ * pointer (they can have several parents), so the iterator keeps the path
+ * from the root to the current node. end() is the empty path.
+ */
+template <typename Value>
+class persistent_map_iterator
+{
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef std::bidirectional_iterator_tag	iterator_category;
+		typedef Value							value_type;
+		typedef Value const *					pointer;
+		typedef Value const &					reference;
+		typedef std::ptrdiff_t					difference_type;
+
+		typedef persistent_node<Value>			node_type;
+
+		/* An AVL tree of height 64 holds more than 2^44 nodes, which
+		 * is more than fits in a 48 bit address space. */
+		enum { max_depth = 64 };
+
+	private:
+		node_type const	*_root;
+		int				_depth;
+		node_type const	*_path[max_depth];
+
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member functions                                     ---*/
+	/*------------------------------------------------------------*/
+
+		persistent_map_iterator(void) : _root(0), _depth(0) { }
+
+		explicit persistent_map_iterator(node_type const *root)
+			: _root(root)
+			, _depth(0)
+		{ }
+
+		persistent_map_iterator(persistent_map_iterator const &other)
+			: _root(other._root)
+			, _depth(other._depth)
+		{
+			for (int i = 0; i < _depth; ++i)
+				_path[i] = other._path[i];
+		}
+
+		persistent_map_iterator &operator=(persistent_map_iterator const &other)
+		{
+			_root = other._root;
+			_depth = other._depth;
+			for (int i = 0; i < _depth; ++i)
+				_path[i] = other._path[i];
+			return *this;
+		}
+
+		reference	operator*() const	{ assert(_depth); return _path[_depth - 1]->value; }
+		pointer		operator->() const	{ return &**this; }
+
+		persistent_map_iterator &operator++()
+		{
+			assert(_depth);
+			node_type const *child = _path[_depth - 1];
+
+			if (child->right) {
+				push(child->right);
+				while (top()->left)
+					push(top()->left);
+			} else {
+				do {
+					child = _path[--_depth];
+				} while (_depth && top()->right == child);
+			}
+			return *this;
+		}
+
+		persistent_map_iterator &operator--()
+		{
+			if (!_depth) {
+				/* --end() is the last element */
+				if (_root) {
+					push(_root);
+					while (top()->right)
+						push(top()->right);
+				}
+				return *this;
+			}
+			node_type const *child = _path[_depth - 1];
+
+			if (child->left) {
+				push(child->left);
+				while (top()->right)
+					push(top()->right);
+			} else {
+				do {
+					child = _path[--_depth];
+				} while (_depth && top()->left == child);
+			}
+			return *this;
+		}
+
+		persistent_map_iterator operator++(int) { persistent_map_iterator tmp(*this); ++*this; return tmp; }
+		persistent_map_iterator operator--(int) { persistent_map_iterator tmp(*this); --*this; return tmp; }
+
+		bool operator==(persistent_map_iterator const &rhs) const
+		{
+			if (!_depth || !rhs._depth)
+				return _depth == rhs._depth;
+			return _path[_depth - 1] == rhs._path[rhs._depth - 1];
+		}
+
+		bool operator!=(persistent_map_iterator const &rhs) const { return !(*this == rhs); }
+
+		/* Used by persistent_map to build iterators while searching. */
+		void				push(node_type const *node) { assert(_depth < max_depth); _path[_depth++] = node; }
+		node_type const		*top(void) const { return _path[_depth - 1]; }
+		void				truncate(int depth) { _depth = depth; }
+		int					depth(void) const { return _depth; }
+};
+
+/* An ordered map with O(1) snapshots.
+ *
+ * The map is an AVL tree of reference counted nodes. Copying the map or
+ * calling snapshot() only bumps the reference count of the root. Updates
+ * copy the nodes that are shared with another snapshot on the path from
+ * the root to the modified node (O(log n) of them) and leave the rest of
+ * the tree shared; nodes that are not shared are updated in place.
+ *
+ * Elements are immutable: iterators are always const iterators.
+ * Reference counts are atomic, so a snapshot may be read and released on
+ * another thread while the map it was taken from keeps being modified.
+ */
+template <
+	class Key,
+	class T,
+	class Compare = less<Key>,
+	class Allocator = std::allocator<pair<const Key, T> >
+>
+class persistent_map
+{
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef Key												key_type;
+		typedef T												mapped_type;
+		typedef pair<const Key, T>								value_type;
+		typedef Compare											key_compare;
+		typedef Allocator										allocator_type;
+		typedef typename Allocator::const_reference				reference;
+		typedef typename Allocator::const_reference				const_reference;
+		typedef typename Allocator::const_pointer				pointer;
+		typedef typename Allocator::const_pointer				const_pointer;
+		typedef size_t											size_type;
+		typedef persistent_map_iterator<value_type>				iterator;
+		typedef persistent_map_iterator<value_type>				const_iterator;
+		typedef ft::reverse_iterator<iterator>					reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+		typedef typename iterator_traits<iterator>::difference_type	difference_type;
+
+	private:
+		typedef persistent_node<value_type>						node_type;
+		typedef typename Allocator::template rebind<node_type>::other	node_allocator;
+
+	/*------------------------------------------------------------*/
+	/*--- Private members                                      ---*/
+	/*------------------------------------------------------------*/
+
+		node_type		*_root;
+		size_type		_size;
+		key_compare		_comp;
+		allocator_type	_allocator;
+		node_allocator	_node_allocator;
+
+	/*------------------------------------------------------------*/
+	/*--- Construct/copy/destroy                               ---*/
+	/*------------------------------------------------------------*/
+
+	public:
+		/* Constructs an empty container, with no elements. */
+		explicit persistent_map(
+			key_compare const &comp = key_compare(),
+			allocator_type const &alloc = allocator_type())
+			: _root(0)
+			, _size(0)
+			, _comp(comp)
+			, _allocator(alloc)
+			, _node_allocator(alloc)
+		{ }
+
+		/* Constructs a container with as many elements as the range [first,last). */
+		template <class InputIterator>
+		persistent_map(
+			InputIterator first,
+			InputIterator last,
+			key_compare const &comp = key_compare(),
+			allocator_type const &alloc = allocator_type(),
+			typename ft::enable_if< !ft::is_integral<InputIterator>::value >::type* = 0)
+			: _root(0)
+			, _size(0)
+			, _comp(comp)
+			, _allocator(alloc)
+			, _node_allocator(alloc)
+		{ insert(first, last); }
+
+		/* Shares the tree of x. This is O(1). */
+		persistent_map(persistent_map const &x)
+			: _root(_retain(x._root))
+			, _size(x._size)
+			, _comp(x._comp)
+			, _allocator(x._allocator)
+			, _node_allocator(x._node_allocator)
+		{ }
+
+		/* Releases the tree. Nodes still shared with another snapshot
+		 * are kept alive.
+		 */
+		~persistent_map(void) { _release(_root); }
+
+		/* Shares the tree of x. This is O(1). */
+		persistent_map &operator=(persistent_map const &x)
+		{
+			node_type *old = _root;
+
+			_root = _retain(x._root);
+			_size = x._size;
+			_comp = x._comp;
+			_release(old);
+			return *this;
+		}
+
+		/* Returns a read-only view of the current contents of the map.
+		 * Later updates of *this are not visible in the snapshot.
+		 */
+		persistent_map snapshot(void) const { return *this; }
+
+		allocator_type get_allocator(void) const { return _allocator; }
+
+	/*------------------------------------------------------------*/
+	/*--- Iterators                                            ---*/
+	/*------------------------------------------------------------*/
+
+		const_iterator begin(void) const
+		{
+			const_iterator it(_root);
+
+			for (node_type const *n = _root; n; n = n->left)
+				it.push(n);
+			return it;
+		}
+
+		const_iterator end(void) const { return const_iterator(_root); }
+
+		const_reverse_iterator rbegin(void) const	{ return const_reverse_iterator(end()); }
+		const_reverse_iterator rend(void) const		{ return const_reverse_iterator(begin()); }
+
+	/*------------------------------------------------------------*/
+	/*--- Capacity                                             ---*/
+	/*------------------------------------------------------------*/
+
+		bool		empty(void) const		{ return _size == 0; }
+		size_type	size(void) const		{ return _size; }
+		size_type	max_size(void) const	{ return _node_allocator.max_size(); }
+
+	/*------------------------------------------------------------*/
+	/*--- Element access                                       ---*/
+	/*------------------------------------------------------------*/
+
+		/* Returns a reference to the mapped value of the element identified with key k. */
+		mapped_type const &at(key_type const &k) const
+		{
+			node_type const *n = _find(k);
+
+			if (!n)
+				throw std::out_of_range("key not found");
+			return n->value.second;
+		}
+
+	/*------------------------------------------------------------*/
+	/*--- Modifiers                                            ---*/
+	/*------------------------------------------------------------*/
+
+		/* Inserts val if its key is not in the map yet. Only the nodes on
+		 * the path to the new leaf that are shared with a snapshot are
+		 * copied. If copying an element throws, the map is left unchanged.
+		 */
+		pair<iterator, bool> insert(value_type const &val)
+		{
+			iterator it = find(val.first);
+
+			if (it != end())
+				return ft::make_pair(it, false);
+			if (_unshared(val.first))
+				_root = _insert_in_place(_root, val);
+			else
+				_replace_root(_insert(_root, val));
+			++_size;
+			return ft::make_pair(find(val.first), true);
+		}
+
+		template <class InputIterator>
+		void insert(
+			InputIterator first,
+			InputIterator last,
+			typename ft::enable_if< !ft::is_integral<InputIterator>::value >::type* = 0)
+		{
+			while (first != last)
+				insert(*first++);
+		}
+
+		/* Inserts val, or replaces the mapped value of the element with
+		 * the same key. Returns true if an element was inserted.
+		 */
+		bool assign(value_type const &val)
+		{
+			bool inserted = (_find(val.first) == 0);
+
+			if (inserted && _unshared(val.first))
+				_root = _insert_in_place(_root, val);
+			else
+				_replace_root(_insert(_root, val));
+			if (inserted)
+				++_size;
+			return inserted;
+		}
+
+		/* Removes the element with key k, if any. Returns the number of
+		 * elements removed.
+		 */
+		size_type erase(key_type const &k)
+		{
+			if (!_find(k))
+				return 0;
+			if (_unshared(k))
+				_root = _erase_in_place(_root, k);
+			else
+				_replace_root(_erase(_root, k));
+			--_size;
+			return 1;
+		}
+
+		void swap(persistent_map &x)
+		{
+			std::swap(_root, x._root);
+			std::swap(_size, x._size);
+			std::swap(_comp, x._comp);
+		}
+
+		void clear(void)
+		{
+			_release(_root);
+			_root = 0;
+			_size = 0;
+		}
+
+	/*------------------------------------------------------------*/
+	/*--- Observers                                            ---*/
+	/*------------------------------------------------------------*/
+
+		key_compare key_comp(void) const { return _comp; }
+
+	/*------------------------------------------------------------*/
+	/*--- Operations                                           ---*/
+	/*------------------------------------------------------------*/
+
+		const_iterator find(key_type const &k) const
+		{
+			const_iterator it = lower_bound(k);
+
+			if (it == end() || _comp(k, it->first))
+				return end();
+			return it;
+		}
+
+		size_type count(key_type const &k) const { return _find(k) ? 1 : 0; }
+
+		const_iterator lower_bound(key_type const &k) const
+		{
+			const_iterator	it(_root);
+			int				found = 0;
+
+			for (node_type const *n = _root; n; ) {
+				it.push(n);
+				if (!_comp(n->value.first, k)) {
+					found = it.depth();
+					n = n->left;
+				} else
+					n = n->right;
+			}
+			it.truncate(found);
+			return it;
+		}
+
+		const_iterator upper_bound(key_type const &k) const
+		{
+			const_iterator	it(_root);
+			int				found = 0;
+
+			for (node_type const *n = _root; n; ) {
+				it.push(n);
+				if (_comp(k, n->value.first)) {
+					found = it.depth();
+					n = n->left;
+				} else
+					n = n->right;
+			}
+			it.truncate(found);
+			return it;
+		}
+
+		pair<const_iterator, const_iterator> equal_range(key_type const &k) const
+		{ return ft::make_pair(lower_bound(k), upper_bound(k)); }
+
+	/*------------------------------------------------------------*/
+	/*--- Tree                                                 ---*/
+	/*------------------------------------------------------------*/
+
+	private:
+		static node_type *_retain(node_type *n)
+		{
+			if (n)
+				__atomic_add_fetch(&n->refs, 1, __ATOMIC_RELAXED);
+			return n;
+		}
+
+		void _release(node_type *n)
+		{
+			if (!n || __atomic_sub_fetch(&n->refs, 1, __ATOMIC_ACQ_REL))
+				return ;
+			_release(n->left);
+			_release(n->right);
+			_allocator.destroy(&n->value);
+			_node_allocator.deallocate(n, 1);
+		}
+
+		node_type *_create(value_type const &val, node_type *left, node_type *right)
+		{
+			node_type *n = _node_allocator.allocate(1);
+
+			try {
+				_allocator.construct(&n->value, val);
+			} catch (...) {
+				_node_allocator.deallocate(n, 1);
+				throw ;
+			}
+			n->left = left;
+			n->right = right;
+			n->refs = 1;
+			_update(n);
+			return n;
+		}
+
+		/* Returns a new node with the value and the children of n, which
+		 * it shares.
+		 */
+		node_type *_clone(node_type *n)
+		{
+			node_type *copy = _create(n->value, 0, 0);
+
+			copy->left = _retain(n->left);
+			copy->right = _retain(n->right);
+			copy->height = n->height;
+			return copy;
+		}
+
+		/* Returns a node that is owned by the caller only: n itself if it
+		 * is not shared, a copy of n sharing its children otherwise. The
+		 * caller's reference to n is dropped, so the result must replace
+		 * n before anything can throw.
+		 */
+		node_type *_unshare(node_type *n)
+		{
+			if (__atomic_load_n(&n->refs, __ATOMIC_ACQUIRE) == 1)
+				return n;
+
+			node_type *copy = _clone(n);
+
+			_release(n);
+			return copy;
+		}
+
+		/* Makes root, a tree built by _insert or _erase, the tree of the
+		 * map, and releases the old one.
+		 */
+		void _replace_root(node_type *root)
+		{
+			node_type *old = _root;
+
+			_root = root;
+			_release(old);
+		}
+
+		static int _height(node_type const *n) { return n ? n->height : 0; }
+
+		static void _update(node_type *n)
+		{
+			int l = _height(n->left);
+			int r = _height(n->right);
+
+			n->height = (l > r ? l : r) + 1;
+		}
+
+		node_type *_rotate_right(node_type *n)
+		{
+			node_type *l = _unshare(n->left);
+
+			n->left = l->right;
+			l->right = n;
+			_update(n);
+			_update(l);
+			return l;
+		}
+
+		node_type *_rotate_left(node_type *n)
+		{
+			node_type *r = _unshare(n->right);
+
+			n->right = r->left;
+			r->left = n;
+			_update(n);
+			_update(r);
+			return r;
+		}
+
+		/* n must be unshared. If this throws, n is still the root of a
+		 * valid tree, which the caller releases.
+		 */
+		node_type *_rebalance(node_type *n)
+		{
+			int balance = _height(n->left) - _height(n->right);
+
+			if (balance > 1) {
+				if (_height(n->left->left) < _height(n->left->right)) {
+					n->left = _unshare(n->left);
+					n->left = _rotate_left(n->left);
+				}
+				return _rotate_right(n);
+			}
+			if (balance < -1) {
+				if (_height(n->right->right) < _height(n->right->left)) {
+					n->right = _unshare(n->right);
+					n->right = _rotate_right(n->right);
+				}
+				return _rotate_left(n);
+			}
+			_update(n);
+			return n;
+		}
+
+		node_type const *_find(key_type const &k) const
+		{
+			node_type const *n = _root;
+
+			while (n) {
+				if (_comp(k, n->value.first))
+					n = n->left;
+				else if (_comp(n->value.first, k))
+					n = n->right;
+				else
+					return n;
+			}
+			return 0;
+		}
+
+		static bool _unique(node_type const *n)
+		{ return !n || __atomic_load_n(&n->refs, __ATOMIC_ACQUIRE) == 1; }
+
+		/* n and its children are unshared */
+		static bool _unique_below(node_type const *n)
+		{ return !n || (_unique(n) && _unique(n->left) && _unique(n->right)); }
+
+		/* Returns true if the nodes an update of key k can touch are all
+		 * unshared: the nodes on the path to k, and on to its successor,
+		 * with their children and grandchildren, which the rotations move.
+		 * The update can then be made in place, and allocates at most the
+		 * new leaf, before it changes anything.
+		 */
+		bool _unshared(key_type const &k) const
+		{
+			node_type const	*n = _root;
+			bool			found = false;
+
+			while (n) {
+				if (!_unique(n) || !_unique_below(n->left) || !_unique_below(n->right))
+					return false;
+				if (found || _comp(k, n->value.first))
+					n = n->left;
+				else if (_comp(n->value.first, k))
+					n = n->right;
+				else {
+					found = true;
+					n = n->right;
+				}
+			}
+			return true;
+		}
+
+		/* The in place updates: every node they touch is unshared. */
+
+		/* The key of val must not be in the subtree n. */
+		node_type *_insert_in_place(node_type *n, value_type const &val)
+		{
+			if (!n)
+				return _create(val, 0, 0);
+			if (_comp(val.first, n->value.first))
+				n->left = _insert_in_place(n->left, val);
+			else
+				n->right = _insert_in_place(n->right, val);
+			return _rebalance(n);
+		}
+
+		/* Detaches the leftmost node of n into min. */
+		node_type *_erase_min_in_place(node_type *n, node_type *&min)
+		{
+			if (!n->left) {
+				node_type *right = n->right;
+
+				n->right = 0;
+				min = n;
+				return right;
+			}
+			n->left = _erase_min_in_place(n->left, min);
+			return _rebalance(n);
+		}
+
+		/* The key k must be in the subtree n. */
+		node_type *_erase_in_place(node_type *n, key_type const &k)
+		{
+			if (_comp(k, n->value.first)) {
+				n->left = _erase_in_place(n->left, k);
+				return _rebalance(n);
+			}
+			if (_comp(n->value.first, k)) {
+				n->right = _erase_in_place(n->right, k);
+				return _rebalance(n);
+			}
+
+			node_type *left = n->left;
+			node_type *right = n->right;
+
+			n->left = 0;
+			n->right = 0;
+			_release(n);
+			if (!left || !right)
+				return left ? left : right;
+
+			node_type *min;
+
+			right = _erase_min_in_place(right, min);
+			min->left = left;
+			min->right = right;
+			return _rebalance(min);
+		}
+
+		/* The functions below build a new tree from n and leave n alone:
+		 * the nodes on the path they change are copied, the others are
+		 * shared. If they throw, the nodes they made are released.
+		 */
+
+		/* Returns n with val in it, in place of the element with the same
+		 * key if there is one.
+		 */
+		node_type *_insert(node_type *n, value_type const &val)
+		{
+			if (!n)
+				return _create(val, 0, 0);
+			if (!_comp(val.first, n->value.first) && !_comp(n->value.first, val.first)) {
+				node_type *copy = _create(val, 0, 0);
+
+				copy->left = _retain(n->left);
+				copy->right = _retain(n->right);
+				copy->height = n->height;
+				return copy;
+			}
+
+			node_type *copy = _clone(n);
+
+			try {
+				if (_comp(val.first, n->value.first))
+					_set_left(copy, _insert(n->left, val));
+				else
+					_set_right(copy, _insert(n->right, val));
+				return _rebalance(copy);
+			} catch (...) {
+				_release(copy);
+				throw ;
+			}
+		}
+
+		/* Returns n without its leftmost node, whose copy is stored in min. */
+		node_type *_erase_min(node_type *n, node_type *&min)
+		{
+			if (!n->left) {
+				min = _create(n->value, 0, 0);
+				return _retain(n->right);
+			}
+
+			node_type *copy = _clone(n);
+
+			min = 0;
+			try {
+				_set_left(copy, _erase_min(n->left, min));
+				return _rebalance(copy);
+			} catch (...) {
+				_release(copy);
+				_release(min);
+				min = 0;
+				throw ;
+			}
+		}
+
+		/* Returns n without the element with key k, which must be in it. */
+		node_type *_erase(node_type *n, key_type const &k)
+		{
+			if (_comp(k, n->value.first) || _comp(n->value.first, k)) {
+				node_type *copy = _clone(n);
+
+				try {
+					if (_comp(k, n->value.first))
+						_set_left(copy, _erase(n->left, k));
+					else
+						_set_right(copy, _erase(n->right, k));
+					return _rebalance(copy);
+				} catch (...) {
+					_release(copy);
+					throw ;
+				}
+			}
+			if (!n->left || !n->right)
+				return _retain(n->left ? n->left : n->right);
+
+			node_type *min;
+			node_type *right = _erase_min(n->right, min);
+
+			min->left = _retain(n->left);
+			min->right = right;
+			try {
+				return _rebalance(min);
+			} catch (...) {
+				_release(min);
+				throw ;
+			}
+		}
+
+		/* Replaces the left (right) child of n, a new node, by child. */
+		void _set_left(node_type *n, node_type *child)
+		{
+			_release(n->left);
+			n->left = child;
+		}
+
+		void _set_right(node_type *n, node_type *child)
+		{
+			_release(n->right);
+			n->right = child;
+		}
+};
+
+/*------------------------------------------------------------*/
+/*--- Non member functions                                 ---*/
+/*------------------------------------------------------------*/
+
+template <class Key, class T, class Compare, class Allocator>
+void swap(
+	persistent_map<Key, T, Compare, Allocator> &x,
+	persistent_map<Key, T, Compare, Allocator> &y) { x.swap(y); }
+
+} /* namespace: ft */
+
+#endif /* __PERSISTENT_MAP_HPP__ */
@@ -0,0 +1,436 @@
+/* priority_queue.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __PRIORITY_QUEUE_HPP__
+# define __PRIORITY_QUEUE_HPP__
+
+# include "iterator_traits.hpp"
+# include "type_traits.hpp"
+# include "less.hpp"
+# include "greater.hpp"
+# include "vector.hpp"
+# include <iterator>
+# include <stddef.h>
+# include <assert.h>
+
+namespace ft
+{
+
+/*------------------------------------------------------------*/
+/*--- d-ary heap algorithms                                ---*/
+/*------------------------------------------------------------*/
+
+/* A d-ary heap stores the children of element i at d * i + 1 to
+ * d * i + d. The element that goes last in the order defined by comp is
+ * at the front. A larger d makes the heap shallower, with the children of
+ * a node next to each other in memory: a push compares with fewer
+ * parents, while a pop compares d children on each of fewer levels.
+ */
+
+/* Moves the element at index i up to its place. */
+template <size_t D, class RandomAccessIterator, class Compare>
+void dary_sift_up(RandomAccessIterator first, size_t i, Compare comp)
+{
+	typename iterator_traits<RandomAccessIterator>::value_type x = first[i];
+
+	while (i) {
+		size_t parent = (i - 1) / D;
+
+		if (!comp(first[parent], x))
+			break;
+		first[i] = first[parent];
+		i = parent;
+	}
+	first[i] = x;
+}
+
+/* Moves the element at index i of a heap of n elements down to its place. */
+template <size_t D, class RandomAccessIterator, class Compare>
+void dary_sift_down(RandomAccessIterator first, size_t n, size_t i, Compare comp)
+{
+	typename iterator_traits<RandomAccessIterator>::value_type x = first[i];
+
+	for (;;) {
+		size_t child = D * i + 1;
+
+		if (child >= n)
+			break;
+
+		size_t last = n - child > D ? child + D : n;
+		size_t best = child;
+
+		while (++child < last)
+			if (comp(first[best], first[child]))
+				best = child;
+		if (!comp(x, first[best]))
+			break;
+		first[i] = first[best];
+		i = best;
+	}
+	first[i] = x;
+}
+
+/* Moves the top of a heap of n elements to index n - 1 and makes a heap
+ * of the n - 1 others. The hole left by the top goes down to a leaf
+ * along the best children without comparing them with the element that
+ * fills it, which usually belongs near the bottom, then that element is
+ * sifted up. This saves one comparison per level over dary_sift_down.
+ */
+template <size_t D, class RandomAccessIterator, class Compare>
+void dary_pop_heap(RandomAccessIterator first, size_t n, Compare comp)
+{
+	typename iterator_traits<RandomAccessIterator>::value_type x = first[--n];
+	size_t i = 0;
+
+	first[n] = first[0];
+	/* nodes with D children: the loop over them has a constant count */
+	while (D * i + D < n) {
+		size_t best = D * i + 1;
+
+		for (size_t child = best + 1; child <= D * i + D; ++child)
+			if (comp(first[best], first[child]))
+				best = child;
+		first[i] = first[best];
+		i = best;
+	}
+	if (D * i + 1 < n) {
+		size_t best = D * i + 1;
+
+		for (size_t child = best + 1; child < n; ++child)
+			if (comp(first[best], first[child]))
+				best = child;
+		first[i] = first[best];
+		i = best;
+	}
+	first[i] = x;
+	dary_sift_up<D>(first, i, comp);
+}
+
+/* Makes a heap out of [first, last) in O(n), sifting down every inner
+ * node from the last one.
+ */
+template <size_t D, class RandomAccessIterator, class Compare>
+void dary_make_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+{
+	size_t n = last - first;
+
+	if (n < 2)
+		return ;
+	for (size_t i = (n - 2) / D + 1; i--; )
+		dary_sift_down<D>(first, n, i, comp);
+}
+
+/*------------------------------------------------------------*/
+/*--- Priority queue                                       ---*/
+/*------------------------------------------------------------*/
+
+/* Container adaptor that gives constant time access to the element that
+ * goes last in the order defined by Compare (the largest one with
+ * ft::less), with logarithmic insertion and extraction.
+ *
+ * The elements are a D-ary heap in Container, which must provide random
+ * access iterators, push_back and pop_back. D defaults to 2, the binary
+ * heap; D = 4 halves the depth, which speeds up pushes, at the cost of
+ * more comparisons per level on pops.
+ */
+template <
+	typename T,
+	typename Container = ft::vector<T>,
+	typename Compare = ft::less<typename Container::value_type>,
+	size_t D = 2>
+class priority_queue
+{
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef Container								container_type;
+		typedef Compare									value_compare;
+		typedef typename Container::value_type			value_type;
+		typedef typename Container::size_type			size_type;
+		typedef typename Container::reference			reference;
+		typedef typename Container::const_reference		const_reference;
+
+		static size_type const	arity = D;
+
+	protected:
+		Container	c;
+		Compare		comp;
+
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member functions                                     ---*/
+	/*------------------------------------------------------------*/
+
+		/* Constructs a queue holding the elements of cont. */
+		explicit priority_queue(
+			Compare const &compare = Compare(),
+			Container const &cont = Container())
+			: c(cont)
+			, comp(compare)
+		{ dary_make_heap<D>(c.begin(), c.end(), comp); }
+
+		/* Constructs a queue holding the elements of cont followed by
+		 * the elements of [first,last).
+		 */
+		template <class InputIterator>
+		priority_queue(
+			InputIterator first,
+			InputIterator last,
+			Compare const &compare = Compare(),
+			Container const &cont = Container(),
+			typename ft::enable_if< !ft::is_integral<InputIterator>::value >::type* = 0)
+			: c(cont)
+			, comp(compare)
+		{
+			c.insert(c.end(), first, last);
+			dary_make_heap<D>(c.begin(), c.end(), comp);
+		}
+
+		bool		empty(void) const	{ return c.empty(); }
+		size_type	size(void) const	{ return c.size(); }
+
+		/* Returns the element that goes last in the order of Compare. */
+		const_reference top(void) const { assert(!empty()); return c.front(); }
+
+		void push(value_type const &x)
+		{
+			c.push_back(x);
+			dary_sift_up<D>(c.begin(), c.size() - 1, comp);
+		}
+
+		/* Inserts the elements of [first,last). When they are many
+		 * compared to the queue, the heap is rebuilt in O(n) rather
+		 * than sifting each element up.
+		 */
+		template <class InputIterator>
+		void push_range(InputIterator first, InputIterator last)
+		{
+			size_type old_size = c.size();
+
+			c.insert(c.end(), first, last);
+
+			size_type n = c.size();
+
+			if (n - old_size > old_size / D) {
+				dary_make_heap<D>(c.begin(), c.end(), comp);
+				return ;
+			}
+			for (size_type i = old_size; i < n; ++i)
+				dary_sift_up<D>(c.begin(), i, comp);
+		}
+
+		/* Removes the top element. */
+		void pop(void)
+		{
+			assert(!empty());
+			dary_pop_heap<D>(c.begin(), c.size(), comp);
+			c.pop_back();
+		}
+
+		void swap(priority_queue &x)
+		{
+			c.swap(x.c);
+			std::swap(comp, x.comp);
+		}
+};
+
+template <typename T, typename Container, typename Compare, size_t D>
+typename priority_queue<T, Container, Compare, D>::size_type const
+	priority_queue<T, Container, Compare, D>::arity;
+
+template <typename T, typename Container, typename Compare, size_t D>
+void swap(
+	priority_queue<T, Container, Compare, D> &x,
+	priority_queue<T, Container, Compare, D> &y) { x.swap(y); }
+
+/*------------------------------------------------------------*/
+/*--- Indexed priority queue                               ---*/
+/*------------------------------------------------------------*/
+
+/* Priority queue whose elements can be changed or removed after they
+ * were pushed, as in Dijkstra or timer wheels.
+ *
+ * push returns a handle that names the element until it is popped or
+ * erased; handles are then reused. The heap holds handles, and the
+ * position of every handle in the heap is kept up to date, so
+ * decrease_key, update and erase are O(D log_D n).
+ */
+template <typename T, typename Compare = ft::less<T>, size_t D = 2>
+class indexed_priority_queue
+{
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef T				value_type;
+		typedef Compare			value_compare;
+		typedef size_t			size_type;
+		typedef size_t			handle_type;
+
+		static size_type const	arity = D;
+		static size_type const	npos = static_cast<size_type>(-1);
+
+	private:
+		ft::vector<value_type>	_values;	/* by handle */
+		ft::vector<handle_type>	_heap;		/* handles in heap order */
+		ft::vector<size_type>	_position;	/* heap index by handle, npos when free */
+		ft::vector<handle_type>	_free;
+		Compare					_comp;
+
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member functions                                     ---*/
+	/*------------------------------------------------------------*/
+
+		explicit indexed_priority_queue(Compare const &compare = Compare()) : _comp(compare) { }
+
+		bool		empty(void) const	{ return _heap.empty(); }
+		size_type	size(void) const	{ return _heap.size(); }
+
+		value_type const	&top(void) const		{ assert(!empty()); return _values[_heap[0]]; }
+		handle_type			top_handle(void) const	{ assert(!empty()); return _heap[0]; }
+
+		/* Returns true if h names an element of the queue. */
+		bool contains(handle_type h) const { return h < _position.size() && _position[h] != npos; }
+
+		value_type const &value(handle_type h) const { assert(contains(h)); return _values[h]; }
+
+		/* Inserts a copy of x and returns its handle. */
+		handle_type push(value_type const &x)
+		{
+			handle_type h;
+
+			if (_free.empty()) {
+				h = _values.size();
+				_values.push_back(x);
+				_position.push_back(npos);
+			} else {
+				h = _free.back();
+				_free.pop_back();
+				_values[h] = x;
+			}
+			_heap.push_back(h);
+			_sift_up(_heap.size() - 1);
+			return h;
+		}
+
+		void pop(void) { erase(top_handle()); }
+
+		/* Replaces the element h by x, which must not go before it in
+		 * the order of Compare: the element can only move toward the top.
+		 * With ft::greater, a min-queue, this is the classic decrease-key.
+		 */
+		void decrease_key(handle_type h, value_type const &x)
+		{
+			assert(contains(h) && !_comp(x, _values[h]));
+			_values[h] = x;
+			_sift_up(_position[h]);
+		}
+
+		/* Replaces the element h by x, which may go anywhere. */
+		void update(handle_type h, value_type const &x)
+		{
+			assert(contains(h));
+
+			bool up = _comp(_values[h], x);
+
+			_values[h] = x;
+			if (up)
+				_sift_up(_position[h]);
+			else
+				_sift_down(_position[h]);
+		}
+
+		/* Removes the element h. */
+		void erase(handle_type h)
+		{
+			assert(contains(h));
+
+			size_type	i = _position[h];
+			handle_type	last = _heap.back();
+
+			_heap.pop_back();
+			_position[h] = npos;
+			_free.push_back(h);
+			if (last == h)
+				return ;
+			_heap[i] = last;
+			_position[last] = i;
+			if (i && _comp(_values[_heap[(i - 1) / D]], _values[last]))
+				_sift_up(i);
+			else
+				_sift_down(i);
+		}
+
+		void clear(void)
+		{
+			_values.clear();
+			_heap.clear();
+			_position.clear();
+			_free.clear();
+		}
+
+	private:
+		void _place(size_type i, handle_type h)
+		{
+			_heap[i] = h;
+			_position[h] = i;
+		}
+
+		void _sift_up(size_type i)
+		{
+			handle_type h = _heap[i];
+
+			while (i) {
+				size_type parent = (i - 1) / D;
+
+				if (!_comp(_values[_heap[parent]], _values[h]))
+					break;
+				_place(i, _heap[parent]);
+				i = parent;
+			}
+			_place(i, h);
+		}
+
+		void _sift_down(size_type i)
+		{
+			handle_type	h = _heap[i];
+			size_type	n = _heap.size();
+
+			for (;;) {
+				size_type child = D * i + 1;
+
+				if (child >= n)
+					break;
+
+				size_type last = n - child > D ? child + D : n;
+				size_type best = child;
+
+				while (++child < last)
+					if (_comp(_values[_heap[best]], _values[_heap[child]]))
+						best = child;
+				if (!_comp(_values[h], _values[_heap[best]]))
+					break;
+				_place(i, _heap[best]);
+				i = best;
+			}
+			_place(i, h);
+		}
+};
+
+template <typename T, typename Compare, size_t D>
+typename indexed_priority_queue<T, Compare, D>::size_type const
+	indexed_priority_queue<T, Compare, D>::arity;
+
+template <typename T, typename Compare, size_t D>
+typename indexed_priority_queue<T, Compare, D>::size_type const
+	indexed_priority_queue<T, Compare, D>::npos;
+
+} /* namespace: ft */
+
+#endif /* __PRIORITY_QUEUE_HPP__ */
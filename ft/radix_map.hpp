@@ -0,0 +1,813 @@
+/* radix_map.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __RADIX_MAP_HPP__
+# define __RADIX_MAP_HPP__
+
+# include "pair.hpp"
+# include "less.hpp"
+# include "equal.hpp"
+# include "lexicographical_compare.hpp"
+# include "reverse_iterator.hpp"
+# include "binary_function.hpp"
+# include "type_traits.hpp"
+# include "compressed_pair.hpp"
+# include "map.hpp"
+# include <iterator>
+# include <memory>
+# include <stdexcept>
+# include <stdint.h>
+# include <limits.h>
+# include <assert.h>
+
+namespace ft
+{
+
+/* Number of bits of the key a node of a radix_map branches on. */
+enum { radix_digit_bits = 6 };
+
+/* Maps an integral key to an unsigned 64-bit code in the same order:
+ * the sign bit of a signed key is flipped, so that negative keys go
+ * first.
+ */
+template <class Key>
+struct radix_key
+{
+	enum { bits = sizeof(Key) * CHAR_BIT };
+
+	static bool const is_signed = Key(-1) < Key(0);
+
+	static uint64_t encode(Key k)
+	{
+		uint64_t u = static_cast<uint64_t>(k) & (~uint64_t(0) >> (64 - bits));
+
+		return is_signed ? u ^ uint64_t(1) << (bits - 1) : u;
+	}
+};
+
+/*------------------------------------------------------------*/
+/*--- Nodes                                                ---*/
+/*------------------------------------------------------------*/
+
+/* The leaves are threaded in key order on a circular list that goes
+ * through the header of the map, like the nodes of ft::map.
+ */
+struct radix_leaf_base
+{
+	radix_leaf_base	*prev;
+	radix_leaf_base	*next;
+};
+
+template <class Value>
+struct radix_leaf : radix_leaf_base
+{
+	Value	value;
+};
+
+/* An inner node branches on the digit of the keys at bit shift. Its
+ * children are inner nodes or leaves (tagged with the low bit), one for
+ * every bit set in bitmap, in order. A node has two children or more:
+ * the levels where all the keys below share a digit are skipped, so a
+ * lookup visits at most one node per digit where the keys differ.
+ */
+struct radix_node
+{
+	uint64_t		prefix;		/* the bits of the keys above the digit */
+	uint64_t		bitmap;
+	uintptr_t		*children;
+	unsigned char	shift;
+	unsigned char	capacity;	/* of children */
+};
+
+/*------------------------------------------------------------*/
+/*--- Iterator                                             ---*/
+/*------------------------------------------------------------*/
+
+/* Bidirectional iterator over the leaves of a radix_map.
+ * Value is const qualified for const iterators.
+ */
+template <typename Leaf, typename Value>
+class radix_map_iterator
+{
+	public:
+		typedef std::bidirectional_iterator_tag	iterator_category;
+		typedef Value							value_type;
+		typedef Value *							pointer;
+		typedef Value &							reference;
+		typedef std::ptrdiff_t					difference_type;
+
+	private:
+		radix_leaf_base	*_leaf;
+
+	public:
+		radix_map_iterator(void) : _leaf(0) { }
+
+		explicit radix_map_iterator(radix_leaf_base const *leaf)
+			: _leaf(const_cast<radix_leaf_base *>(leaf))
+		{ }
+
+		/* Converts an iterator to a const iterator, never the other way.
+		 * For an iterator this is the copy constructor.
+		 */
+		radix_map_iterator(radix_map_iterator<Leaf, typename remove_const<Value>::type> const &other)
+			: _leaf(other.leaf())
+		{ }
+
+		reference	operator*() const	{ return static_cast<Leaf *>(_leaf)->value; }
+		pointer		operator->() const	{ return &static_cast<Leaf *>(_leaf)->value; }
+
+		radix_map_iterator	&operator++()		{ _leaf = _leaf->next; return *this; }
+		radix_map_iterator	&operator--()		{ _leaf = _leaf->prev; return *this; }
+		radix_map_iterator	operator++(int)		{ radix_map_iterator tmp(*this); _leaf = _leaf->next; return tmp; }
+		radix_map_iterator	operator--(int)		{ radix_map_iterator tmp(*this); _leaf = _leaf->prev; return tmp; }
+
+		radix_leaf_base		*leaf(void) const	{ return _leaf; }
+};
+
+template <typename Leaf, typename V1, typename V2>
+bool operator==(
+	radix_map_iterator<Leaf, V1> const &lhs,
+	radix_map_iterator<Leaf, V2> const &rhs) { return lhs.leaf() == rhs.leaf(); }
+
+template <typename Leaf, typename V1, typename V2>
+bool operator!=(
+	radix_map_iterator<Leaf, V1> const &lhs,
+	radix_map_iterator<Leaf, V2> const &rhs) { return lhs.leaf() != rhs.leaf(); }
+
+/*------------------------------------------------------------*/
+/*--- Radix map                                            ---*/
+/*------------------------------------------------------------*/
+
+/* Ordered map for integral keys, with the interface of ft::map ordered
+ * by ft::less<Key>.
+ *
+ * The keys are the paths of a compressed radix tree of 64-way nodes, so
+ * a lookup reads a digit of the key per level and never compares it with
+ * the keys on the way: find, lower_bound and upper_bound visit at most
+ * one node per 6 bits of the key, whatever the size of the map, and
+ * fewer where the keys are sparse. lower_bound goes down to the first
+ * digit that has no child for the key, then takes the smallest key of
+ * the next child in the bitmap, or the successor of the largest key of
+ * the node on the list, without backtracking. Elements never move:
+ * inserting and erasing invalidate only the erased elements.
+ */
+template <
+	class Key,
+	class T,
+	class Allocator = std::allocator<pair<const Key, T> > >
+class radix_map
+{
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef Key											key_type;
+		typedef T											mapped_type;
+		typedef pair<const Key, T>							value_type;
+		typedef less<Key>									key_compare;
+		typedef Allocator									allocator_type;
+		typedef typename Allocator::reference				reference;
+		typedef typename Allocator::const_reference			const_reference;
+		typedef size_t										size_type;
+		typedef typename Allocator::pointer					pointer;
+		typedef typename Allocator::const_pointer			const_pointer;
+
+	private:
+		typedef radix_leaf<value_type>										leaf;
+		typedef typename Allocator::template rebind<leaf>::other			leaf_allocator;
+		typedef typename Allocator::template rebind<radix_node>::other		node_allocator;
+		typedef typename Allocator::template rebind<uintptr_t>::other		array_allocator;
+
+	public:
+		typedef radix_map_iterator<leaf, value_type>			iterator;
+		typedef radix_map_iterator<leaf, value_type const>		const_iterator;
+		typedef ft::reverse_iterator<iterator>					reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+		typedef std::ptrdiff_t									difference_type;
+
+		/* Function object that compares two elements by their keys. */
+		class value_compare : public binary_function<value_type, value_type, bool>
+		{
+			public:
+				bool operator()(value_type const &x, value_type const &y) const
+				{ return x.first < y.first; }
+		};
+
+	private:
+		typedef char _integral_key[sizeof(static_assertion<is_integral<Key>::value>)];
+
+	/*------------------------------------------------------------*/
+	/*--- Private members                                      ---*/
+	/*------------------------------------------------------------*/
+
+		radix_leaf_base		_header;
+		uintptr_t			_root;		/* 0, a tagged leaf or a node */
+		/* the allocator takes no room when it is stateless */
+		compressed_pair<allocator_type, size_type>	_impl;
+
+		allocator_type			&_allocator(void)		{ return _impl.first(); }
+		allocator_type const	&_allocator(void) const	{ return _impl.first(); }
+		size_type				&_size(void)			{ return _impl.second(); }
+		size_type const			&_size(void) const		{ return _impl.second(); }
+
+	/*------------------------------------------------------------*/
+	/*--- Construct/copy/destroy                               ---*/
+	/*------------------------------------------------------------*/
+
+	public:
+		/* Constructs an empty container, with no elements. */
+		explicit radix_map(
+			key_compare const & = key_compare(),
+			allocator_type const &alloc = allocator_type())
+			: _root(0)
+			, _impl(alloc, 0)
+		{ _reset(); }
+
+		/* Constructs a container with as many elements as the range [first,last). */
+		template <class InputIterator>
+		radix_map(
+			InputIterator first,
+			InputIterator last,
+			key_compare const & = key_compare(),
+			allocator_type const &alloc = allocator_type(),
+			typename ft::enable_if< !ft::is_integral<InputIterator>::value >::type* = 0)
+			: _root(0)
+			, _impl(alloc, 0)
+		{
+			_reset();
+			try {
+				insert(first, last);
+			} catch (...) {
+				clear();
+				throw ;
+			}
+		}
+
+		/* Constructs a container with a copy of each of the elements in x. */
+		radix_map(radix_map const &x)
+			: _root(0)
+			, _impl(x._allocator(), 0)
+		{
+			_reset();
+			try {
+				insert(x.begin(), x.end());
+			} catch (...) {
+				clear();
+				throw ;
+			}
+		}
+
+		~radix_map(void) { clear(); }
+
+		radix_map &operator=(radix_map const &x)
+		{
+			if (this != &x) {
+				clear();
+				insert(x.begin(), x.end());
+			}
+			return *this;
+		}
+
+	/*------------------------------------------------------------*/
+	/*--- Iterators                                            ---*/
+	/*------------------------------------------------------------*/
+
+		iterator		begin(void)			{ return iterator(_header.next); }
+		const_iterator	begin(void) const	{ return const_iterator(_header.next); }
+
+		iterator		end(void)			{ return iterator(&_header); }
+		const_iterator	end(void) const		{ return const_iterator(&_header); }
+
+		reverse_iterator		rbegin(void)		{ return reverse_iterator(end()); }
+		const_reverse_iterator	rbegin(void) const	{ return const_reverse_iterator(end()); }
+
+		reverse_iterator		rend(void)			{ return reverse_iterator(begin()); }
+		const_reverse_iterator	rend(void) const	{ return const_reverse_iterator(begin()); }
+
+	/*------------------------------------------------------------*/
+	/*--- Capacity                                             ---*/
+	/*------------------------------------------------------------*/
+
+		bool		empty(void) const		{ return _size() == 0; }
+		size_type	size(void) const		{ return _size(); }
+		size_type	max_size(void) const	{ return leaf_allocator(_allocator()).max_size(); }
+
+	/*------------------------------------------------------------*/
+	/*--- Element access                                       ---*/
+	/*------------------------------------------------------------*/
+
+		mapped_type &operator[](key_type const &k)
+		{ return insert(value_type(k, mapped_type())).first->second; }
+
+		/* Returns a reference to the mapped value of the element identified with key k. */
+		mapped_type &at(key_type const &k)
+		{
+			iterator it = find(k);
+
+			if (it == end())
+				throw std::out_of_range("key not found");
+			return it->second;
+		}
+
+		mapped_type const &at(key_type const &k) const
+		{
+			const_iterator it = find(k);
+
+			if (it == end())
+				throw std::out_of_range("key not found");
+			return it->second;
+		}
+
+	/*------------------------------------------------------------*/
+	/*--- Modifiers                                            ---*/
+	/*------------------------------------------------------------*/
+
+		/* Inserts val if its key is not in the map yet. */
+		pair<iterator, bool> insert(value_type const &val)
+		{
+			uint64_t	u = _encode(val.first);
+			uintptr_t	*slot = &_root;
+
+			while (*slot) {
+				uintptr_t p = *slot;
+
+				if (_is_leaf(p)) {
+					radix_leaf_base *y = _leaf(p);
+
+					if (_code(y) == u)
+						return ft::make_pair(iterator(y), false);
+					return ft::make_pair(_insert_branch(slot, u, _code(y), val,
+						u < _code(y) ? y : y->next), true);
+				}
+
+				radix_node *n = _node(p);
+
+				if (_high(u, n->shift) != n->prefix) {
+					uint64_t v = n->prefix << (n->shift + radix_digit_bits);
+
+					return ft::make_pair(_insert_branch(slot, u, v, val,
+						u < v ? _min(p) : _max(p)->next), true);
+				}
+
+				unsigned d = _digit(u, n->shift);
+
+				if (!(n->bitmap >> d & 1))
+					return ft::make_pair(_insert_child(n, d, val), true);
+				slot = &n->children[_rank(n->bitmap, d)];
+			}
+
+			leaf *x = _create_leaf(val);
+
+			_root = _tag(x);
+			_link(x, &_header);
+			return ft::make_pair(iterator(x), true);
+		}
+
+		/* The hint is not used: an insertion costs the same anywhere. */
+		iterator insert(iterator, value_type const &val) { return insert(val).first; }
+
+		template <class InputIterator>
+		void insert(
+			InputIterator first,
+			InputIterator last,
+			typename ft::enable_if< !ft::is_integral<InputIterator>::value >::type* = 0)
+		{
+			while (first != last)
+				insert(*first++);
+		}
+
+		void erase(iterator position)
+		{
+			assert(position != end());
+
+			radix_leaf_base	*x = position.leaf();
+			uint64_t		u = _code(x);
+			uintptr_t		*slot = &_root;
+			uintptr_t		*parent_slot = 0;
+
+			while (!_is_leaf(*slot)) {
+				parent_slot = slot;
+				slot = &_node(*slot)->children[_rank(_node(*slot)->bitmap, _digit(u, _node(*slot)->shift))];
+			}
+			assert(_leaf(*slot) == x);
+			if (!parent_slot)
+				_root = 0;
+			else
+				_remove_child(parent_slot, _digit(u, _node(*parent_slot)->shift));
+			x->prev->next = x->next;
+			x->next->prev = x->prev;
+			_destroy_leaf(static_cast<leaf *>(x));
+			--_size();
+		}
+
+		size_type erase(key_type const &k)
+		{
+			iterator it = find(k);
+
+			if (it == end())
+				return 0;
+			erase(it);
+			return 1;
+		}
+
+		void erase(iterator first, iterator last)
+		{
+			if (first == begin() && last == end()) {
+				clear();
+				return ;
+			}
+			while (first != last)
+				erase(first++);
+		}
+
+		/* Exchanges the content of the container by the content of x. */
+		void swap(radix_map &x)
+		{
+			std::swap(_header, x._header);
+			std::swap(_root, x._root);
+			std::swap(_size(), x._size());
+			_fix_header();
+			x._fix_header();
+		}
+
+		void clear(void)
+		{
+			radix_leaf_base *x = _header.next;
+
+			while (x != &_header) {
+				radix_leaf_base *next = x->next;
+
+				_destroy_leaf(static_cast<leaf *>(x));
+				x = next;
+			}
+			if (_root && !_is_leaf(_root))
+				_destroy_nodes(_node(_root));
+			_root = 0;
+			_reset();
+		}
+
+	/*------------------------------------------------------------*/
+	/*--- Observers                                            ---*/
+	/*------------------------------------------------------------*/
+
+		key_compare		key_comp(void) const	{ return key_compare(); }
+		value_compare	value_comp(void) const	{ return value_compare(); }
+
+	/*------------------------------------------------------------*/
+	/*--- Operations                                           ---*/
+	/*------------------------------------------------------------*/
+
+		iterator		find(key_type const &k)			{ return iterator(_find(_encode(k))); }
+		const_iterator	find(key_type const &k) const	{ return const_iterator(_find(_encode(k))); }
+
+		size_type count(key_type const &k) const { return _find(_encode(k)) != &_header; }
+
+		/* Returns an iterator to the first element whose key does not go
+		 * before k.
+		 */
+		iterator		lower_bound(key_type const &k)			{ return iterator(_lower_bound(_encode(k))); }
+		const_iterator	lower_bound(key_type const &k) const	{ return const_iterator(_lower_bound(_encode(k))); }
+
+		/* Returns an iterator to the first element whose key goes after k. */
+		iterator		upper_bound(key_type const &k)			{ return iterator(_upper_bound(_encode(k))); }
+		const_iterator	upper_bound(key_type const &k) const	{ return const_iterator(_upper_bound(_encode(k))); }
+
+		pair<iterator, iterator> equal_range(key_type const &k)
+		{ return ft::make_pair(lower_bound(k), upper_bound(k)); }
+
+		pair<const_iterator, const_iterator> equal_range(key_type const &k) const
+		{ return ft::make_pair(lower_bound(k), upper_bound(k)); }
+
+		allocator_type get_allocator(void) const { return _allocator(); }
+
+	/*------------------------------------------------------------*/
+	/*--- Tree                                                 ---*/
+	/*------------------------------------------------------------*/
+
+	private:
+		static uint64_t _encode(key_type const &k) { return radix_key<Key>::encode(k); }
+
+		static uint64_t _code(radix_leaf_base const *x)
+		{ return _encode(static_cast<leaf const *>(x)->value.first); }
+
+		static bool				_is_leaf(uintptr_t p)	{ return p & 1; }
+		static uintptr_t		_tag(leaf *x)			{ return reinterpret_cast<uintptr_t>(x) | 1; }
+		static radix_leaf_base	*_leaf(uintptr_t p)		{ return reinterpret_cast<leaf *>(p & ~uintptr_t(1)); }
+		static radix_node		*_node(uintptr_t p)		{ return reinterpret_cast<radix_node *>(p); }
+
+		/* The bits of u above the digit at shift. */
+		static uint64_t _high(uint64_t u, unsigned shift)
+		{ return shift + radix_digit_bits >= 64 ? 0 : u >> (shift + radix_digit_bits); }
+
+		static unsigned _digit(uint64_t u, unsigned shift)
+		{ return (u >> shift) & ((1 << radix_digit_bits) - 1); }
+
+		/* Index in the children of the child for digit d. */
+		static unsigned _rank(uint64_t bitmap, unsigned d)
+		{ return __builtin_popcountll(bitmap & ((uint64_t(1) << d) - 1)); }
+
+		static unsigned _children(radix_node const *n) { return __builtin_popcountll(n->bitmap); }
+
+		/* The leaves with the smallest and the largest keys below p. */
+		static radix_leaf_base *_min(uintptr_t p)
+		{
+			while (!_is_leaf(p))
+				p = _node(p)->children[0];
+			return _leaf(p);
+		}
+
+		static radix_leaf_base *_max(uintptr_t p)
+		{
+			while (!_is_leaf(p))
+				p = _node(p)->children[_children(_node(p)) - 1];
+			return _leaf(p);
+		}
+
+		radix_leaf_base *_find(uint64_t u) const
+		{
+			uintptr_t p = _root;
+
+			if (!p)
+				return const_cast<radix_leaf_base *>(&_header);
+			while (!_is_leaf(p)) {
+				radix_node const	*n = _node(p);
+				unsigned			d = _digit(u, n->shift);
+
+				if (_high(u, n->shift) != n->prefix || !(n->bitmap >> d & 1))
+					return const_cast<radix_leaf_base *>(&_header);
+				p = n->children[_rank(n->bitmap, d)];
+			}
+			return _code(_leaf(p)) == u ? _leaf(p) : const_cast<radix_leaf_base *>(&_header);
+		}
+
+		radix_leaf_base *_lower_bound(uint64_t u) const
+		{
+			uintptr_t p = _root;
+
+			if (!p)
+				return const_cast<radix_leaf_base *>(&_header);
+			while (!_is_leaf(p)) {
+				radix_node const	*n = _node(p);
+				uint64_t			high = _high(u, n->shift);
+
+				/* every key below n goes after u, or before it */
+				if (high < n->prefix)
+					return _min(p);
+				if (high > n->prefix)
+					return _max(p)->next;
+
+				unsigned d = _digit(u, n->shift);
+
+				if (n->bitmap >> d & 1) {
+					p = n->children[_rank(n->bitmap, d)];
+					continue ;
+				}
+				if (d < 63 && n->bitmap >> d >> 1)
+					return _min(n->children[_rank(n->bitmap, d)]);
+				return _max(p)->next;
+			}
+			return _code(_leaf(p)) >= u ? _leaf(p) : _leaf(p)->next;
+		}
+
+		radix_leaf_base *_upper_bound(uint64_t u) const
+		{
+			radix_leaf_base *x = _lower_bound(u);
+
+			if (x != &_header && _code(x) == u)
+				x = x->next;
+			return x;
+		}
+
+		/* Replaces *slot, the subtree whose keys start like v, by a node
+		 * that branches between it and a new leaf for val, whose key has
+		 * the code u, and links the leaf right before next.
+		 */
+		iterator _insert_branch(uintptr_t *slot, uint64_t u, uint64_t v,
+			value_type const &val, radix_leaf_base *next)
+		{
+			unsigned	bit = 63 - __builtin_clzll(u ^ v);
+			unsigned	shift = bit - bit % radix_digit_bits;
+			leaf		*x = _create_leaf(val);
+			radix_node	*n;
+
+			try {
+				n = _create_node(shift, _high(u, shift), 2);
+			} catch (...) {
+				_destroy_leaf(x);
+				throw ;
+			}
+			n->bitmap = uint64_t(1) << _digit(u, shift) | uint64_t(1) << _digit(v, shift);
+			n->children[u > v] = _tag(x);
+			n->children[u < v] = *slot;
+			*slot = reinterpret_cast<uintptr_t>(n);
+			_link(x, next);
+			return iterator(x);
+		}
+
+		/* Adds a leaf for val as the child of n for digit d. */
+		iterator _insert_child(radix_node *n, unsigned d, value_type const &val)
+		{
+			unsigned		count = _children(n);
+			unsigned		i = _rank(n->bitmap, d);
+			radix_leaf_base	*next = i < count ? _min(n->children[i]) : _max(n->children[count - 1])->next;
+			leaf			*x = _create_leaf(val);
+
+			if (count == n->capacity) {
+				unsigned	capacity = 2 * count < 64 ? 2 * count : 64;
+				uintptr_t	*children;
+
+				try {
+					children = array_allocator(_allocator()).allocate(capacity);
+				} catch (...) {
+					_destroy_leaf(x);
+					throw ;
+				}
+				for (unsigned j = 0; j < count; ++j)
+					children[j] = n->children[j];
+				array_allocator(_allocator()).deallocate(n->children, n->capacity);
+				n->children = children;
+				n->capacity = capacity;
+			}
+			for (unsigned j = count; j > i; --j)
+				n->children[j] = n->children[j - 1];
+			n->children[i] = _tag(x);
+			n->bitmap |= uint64_t(1) << d;
+			_link(x, next);
+			return iterator(x);
+		}
+
+		/* Removes the child for digit d of the node at *slot. A node left
+		 * with one child is replaced by it.
+		 */
+		void _remove_child(uintptr_t *slot, unsigned d)
+		{
+			radix_node	*n = _node(*slot);
+			unsigned	count = _children(n);
+			unsigned	i = _rank(n->bitmap, d);
+
+			if (count == 2) {
+				*slot = n->children[!i];
+				_destroy_node(n);
+				return ;
+			}
+			for (unsigned j = i; j + 1 < count; ++j)
+				n->children[j] = n->children[j + 1];
+			n->bitmap &= ~(uint64_t(1) << d);
+		}
+
+		void _link(radix_leaf_base *x, radix_leaf_base *next)
+		{
+			x->next = next;
+			x->prev = next->prev;
+			next->prev->next = x;
+			next->prev = x;
+			++_size();
+		}
+
+		leaf *_create_leaf(value_type const &val)
+		{
+			leaf_allocator	alloc(_allocator());
+			leaf			*x = alloc.allocate(1);
+
+			try {
+				_allocator().construct(&x->value, val);
+			} catch (...) {
+				alloc.deallocate(x, 1);
+				throw ;
+			}
+			return x;
+		}
+
+		void _destroy_leaf(leaf *x)
+		{
+			_allocator().destroy(&x->value);
+			leaf_allocator(_allocator()).deallocate(x, 1);
+		}
+
+		radix_node *_create_node(unsigned shift, uint64_t prefix, unsigned capacity)
+		{
+			node_allocator	alloc(_allocator());
+			radix_node		*n = alloc.allocate(1);
+
+			try {
+				n->children = array_allocator(_allocator()).allocate(capacity);
+			} catch (...) {
+				alloc.deallocate(n, 1);
+				throw ;
+			}
+			n->prefix = prefix;
+			n->shift = shift;
+			n->capacity = capacity;
+			return n;
+		}
+
+		void _destroy_node(radix_node *n)
+		{
+			array_allocator(_allocator()).deallocate(n->children, n->capacity);
+			node_allocator(_allocator()).deallocate(n, 1);
+		}
+
+		/* Frees the nodes below n, but not the leaves. */
+		void _destroy_nodes(radix_node *n)
+		{
+			for (unsigned i = 0, count = _children(n); i < count; ++i) {
+				if (!_is_leaf(n->children[i]))
+					_destroy_nodes(_node(n->children[i]));
+			}
+			_destroy_node(n);
+		}
+
+		void _reset(void)
+		{
+			_header.next = &_header;
+			_header.prev = &_header;
+			_size() = 0;
+		}
+
+		/* Points the ends of the list back to the header after it moved. */
+		void _fix_header(void)
+		{
+			if (_size()) {
+				_header.next->prev = &_header;
+				_header.prev->next = &_header;
+			} else {
+				_header.next = &_header;
+				_header.prev = &_header;
+			}
+		}
+};
+
+/*------------------------------------------------------------*/
+/*--- Non member functions                                 ---*/
+/*------------------------------------------------------------*/
+
+template <class Key, class T, class Allocator>
+bool operator==(
+	radix_map<Key, T, Allocator> const &x,
+	radix_map<Key, T, Allocator> const &y)
+{
+	return x.size() == y.size()
+		&& ft::equal(x.begin(), x.end(), y.begin());
+}
+
+template <class Key, class T, class Allocator>
+bool operator!=(
+	radix_map<Key, T, Allocator> const &x,
+	radix_map<Key, T, Allocator> const &y) { return !(x == y); }
+
+template <class Key, class T, class Allocator>
+bool operator<(
+	radix_map<Key, T, Allocator> const &x,
+	radix_map<Key, T, Allocator> const &y)
+{
+	return ft::lexicographical_compare(
+		x.begin(), x.end(),
+		y.begin(), y.end());
+}
+
+template <class Key, class T, class Allocator>
+bool operator>(
+	radix_map<Key, T, Allocator> const &x,
+	radix_map<Key, T, Allocator> const &y) { return y < x; }
+
+template <class Key, class T, class Allocator>
+bool operator<=(
+	radix_map<Key, T, Allocator> const &x,
+	radix_map<Key, T, Allocator> const &y) { return !(y < x); }
+
+template <class Key, class T, class Allocator>
+bool operator>=(
+	radix_map<Key, T, Allocator> const &x,
+	radix_map<Key, T, Allocator> const &y) { return !(x < y); }
+
+template <class Key, class T, class Allocator>
+void swap(
+	radix_map<Key, T, Allocator> &x,
+	radix_map<Key, T, Allocator> &y) { x.swap(y); }
+
+/*------------------------------------------------------------*/
+/*--- Selection                                            ---*/
+/*------------------------------------------------------------*/
+
+/* The ordered map to use for keys of type Key: a radix_map when Key is
+ * integral and ordered by ft::less, an ft::map otherwise.
+ */
+template <
+	class Key,
+	class T,
+	class Compare = less<Key>,
+	class Allocator = std::allocator<pair<const Key, T> > >
+struct select_map
+{
+	typedef typename conditional<
+		is_integral<Key>::value && is_same<Compare, less<Key> >::value,
+		radix_map<Key, T, Allocator>,
+		map<Key, T, Compare, Allocator> >::type		type;
+};
+
+} /* namespace: ft */
+
+#endif /* __RADIX_MAP_HPP__ */
@@ -0,0 +1,603 @@
+/* rb_tree.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __RB_TREE_HPP__
+# define __RB_TREE_HPP__
+
+# include "type_traits.hpp"
+# include <iterator>
+# include <stddef.h>
+
+namespace ft
+{
+
+/* Red-black tree algorithms used by ft::map.
+ *
+ * The algorithms work on rb_node_base, which only holds the links. The
+ * tree has a header node: header.parent is the root. The header is the
+ * end() node; it is red and is the parent of the root.
+ *
+ * Besides the tree links, the nodes are threaded in key order on a
+ * circular list that goes through the header: next is the in-order
+ * successor and prev the predecessor. Walking the map is then one load
+ * per step instead of a walk up and down the tree, and header.next and
+ * header.prev are the leftmost and rightmost nodes. An empty tree has
+ * header.next == header.prev == &header.
+ *
+ * The algorithms never read or write header.left and header.right, so a
+ * container can keep data of its own there.
+ */
+
+enum rb_color { rb_red = false, rb_black = true };
+
+struct rb_node_base
+{
+	rb_node_base	*parent;
+	rb_node_base	*left;
+	rb_node_base	*right;
+	rb_node_base	*next;
+	rb_node_base	*prev;
+	rb_color		color;
+};
+
+/*------------------------------------------------------------*/
+/*--- Augmentation policies                                ---*/
+/*------------------------------------------------------------*/
+
+/* A policy decides what is stored in the nodes besides the links and
+ * keeps it up to date when the shape of the tree changes. Every hook of
+ * no_order_statistics is empty, so a map using it pays nothing.
+ */
+struct no_order_statistics
+{
+	struct node_base : rb_node_base { };
+
+	/* n was just allocated */
+	static void init(rb_node_base *) { }
+	/* n was linked into the tree: its ancestors gained one node */
+	static void grow(rb_node_base *, rb_node_base *) { }
+	/* the ancestors of n, starting with n itself, lost one node */
+	static void shrink(rb_node_base *, rb_node_base *) { }
+	/* y took the place of x in the tree */
+	static void replace(rb_node_base *, rb_node_base *) { }
+	/* y was rotated above x */
+	static void rotate(rb_node_base *, rb_node_base *) { }
+	/* recompute n from its children */
+	static void update(rb_node_base *) { }
+	/* stores the number of nodes of the subtree n in size if it is
+	 * known without walking the subtree */
+	static bool count(rb_node_base const *, size_t &) { return false; }
+};
+
+/* Stores the size of the subtree in every node, which gives O(log n)
+ * select (map::nth) and rank (map::rank, map::index_of) queries.
+ */
+struct order_statistics
+{
+	struct node_base : rb_node_base { size_t size; };
+
+	static size_t size(rb_node_base const *n)
+	{ return n ? static_cast<node_base const *>(n)->size : 0; }
+
+	static void init(rb_node_base *n) { static_cast<node_base *>(n)->size = 1; }
+
+	static void grow(rb_node_base *n, rb_node_base *header)
+	{
+		for (; n != header; n = n->parent)
+			++static_cast<node_base *>(n)->size;
+	}
+
+	static void shrink(rb_node_base *n, rb_node_base *header)
+	{
+		for (; n != header; n = n->parent)
+			--static_cast<node_base *>(n)->size;
+	}
+
+	static void replace(rb_node_base *x, rb_node_base *y)
+	{ static_cast<node_base *>(y)->size = static_cast<node_base *>(x)->size; }
+
+	static void rotate(rb_node_base *x, rb_node_base *y)
+	{
+		replace(x, y);
+		update(x);
+	}
+
+	static void update(rb_node_base *n)
+	{ static_cast<node_base *>(n)->size = size(n->left) + size(n->right) + 1; }
+
+	static bool count(rb_node_base const *n, size_t &size)
+	{
+		size = order_statistics::size(n);
+		return true;
+	}
+};
+
+template <typename Value, typename Policy>
+struct rb_node : public Policy::node_base
+{
+	typedef Value	value_type;
+	typedef Policy	policy_type;
+
+	Value	value;
+};
+
+/*------------------------------------------------------------*/
+/*--- Tree algorithms                                      ---*/
+/*------------------------------------------------------------*/
+
+inline rb_node_base *rb_minimum(rb_node_base *x)
+{
+	while (x->left)
+		x = x->left;
+	return x;
+}
+
+inline rb_node_base *rb_maximum(rb_node_base *x)
+{
+	while (x->right)
+		x = x->right;
+	return x;
+}
+
+/* In-order successor. The successor of the rightmost node is the header. */
+inline rb_node_base *rb_increment(rb_node_base *x) { return x->next; }
+
+/* In-order predecessor. The predecessor of the header is the rightmost node. */
+inline rb_node_base *rb_decrement(rb_node_base *x) { return x->prev; }
+
+/* Threads x on the list right before pos. */
+inline void rb_link_before(rb_node_base *x, rb_node_base *pos)
+{
+	x->next = pos;
+	x->prev = pos->prev;
+	pos->prev->next = x;
+	pos->prev = x;
+}
+
+/* Takes x off the list. */
+inline void rb_unlink(rb_node_base *x)
+{
+	x->prev->next = x->next;
+	x->next->prev = x->prev;
+}
+
+template <typename Policy>
+void rb_rotate_left(rb_node_base *x, rb_node_base *&root)
+{
+	rb_node_base *y = x->right;
+
+	x->right = y->left;
+	if (y->left)
+		y->left->parent = x;
+	y->parent = x->parent;
+	if (x == root)
+		root = y;
+	else if (x == x->parent->left)
+		x->parent->left = y;
+	else
+		x->parent->right = y;
+	y->left = x;
+	x->parent = y;
+	Policy::rotate(x, y);
+}
+
+template <typename Policy>
+void rb_rotate_right(rb_node_base *x, rb_node_base *&root)
+{
+	rb_node_base *y = x->left;
+
+	x->left = y->right;
+	if (y->right)
+		y->right->parent = x;
+	y->parent = x->parent;
+	if (x == root)
+		root = y;
+	else if (x == x->parent->right)
+		x->parent->right = y;
+	else
+		x->parent->left = y;
+	y->right = x;
+	x->parent = y;
+	Policy::rotate(x, y);
+}
+
+/* Restores the red-black properties after the red node x was linked
+ * under a node that may be red. The root may be left red.
+ */
+template <typename Policy>
+void rb_rebalance_after_insert(rb_node_base *x, rb_node_base *&root)
+{
+	while (x != root && x->parent->color == rb_red) {
+		rb_node_base *xpp = x->parent->parent;
+
+		if (x->parent == xpp->left) {
+			rb_node_base *y = xpp->right;
+
+			if (y && y->color == rb_red) {
+				x->parent->color = rb_black;
+				y->color = rb_black;
+				xpp->color = rb_red;
+				x = xpp;
+			} else {
+				if (x == x->parent->right) {
+					x = x->parent;
+					rb_rotate_left<Policy>(x, root);
+				}
+				x->parent->color = rb_black;
+				xpp->color = rb_red;
+				rb_rotate_right<Policy>(xpp, root);
+			}
+		} else {
+			rb_node_base *y = xpp->left;
+
+			if (y && y->color == rb_red) {
+				x->parent->color = rb_black;
+				y->color = rb_black;
+				xpp->color = rb_red;
+				x = xpp;
+			} else {
+				if (x == x->parent->left) {
+					x = x->parent;
+					rb_rotate_right<Policy>(x, root);
+				}
+				x->parent->color = rb_black;
+				xpp->color = rb_red;
+				rb_rotate_left<Policy>(xpp, root);
+			}
+		}
+	}
+}
+
+/* Links x as the left (or right) child of p, which has no such child,
+ * and restores the red-black properties.
+ */
+template <typename Policy>
+void rb_insert_and_rebalance(
+	bool insert_left,
+	rb_node_base *x,
+	rb_node_base *p,
+	rb_node_base &header)
+{
+	rb_node_base *&root = header.parent;
+
+	x->parent = p;
+	x->left = 0;
+	x->right = 0;
+	x->color = rb_red;
+	Policy::init(x);
+
+	if (p == &header) {
+		header.parent = x;
+		rb_link_before(x, &header);
+	} else if (insert_left) {
+		p->left = x;
+		rb_link_before(x, p);
+	} else {
+		p->right = x;
+		rb_link_before(x, p->next);
+	}
+	Policy::grow(p, &header);
+
+	rb_rebalance_after_insert<Policy>(x, root);
+	root->color = rb_black;
+}
+
+/* Unlinks z from the tree and restores the red-black properties.
+ * Returns z, which can then be destroyed.
+ */
+template <typename Policy>
+rb_node_base *rb_erase_and_rebalance(rb_node_base *z, rb_node_base &header)
+{
+	rb_node_base *&root = header.parent;
+	rb_node_base *y = z;
+	rb_node_base *x = 0;
+	rb_node_base *x_parent = 0;
+
+	rb_unlink(z);
+
+	if (!y->left)
+		x = y->right;
+	else if (!y->right)
+		x = y->left;
+	else {
+		/* z has two children: y is its successor, which has no left child */
+		y = rb_minimum(y->right);
+		x = y->right;
+	}
+	Policy::shrink(y->parent, &header);
+
+	if (y != z) {
+		/* relink y in place of z */
+		z->left->parent = y;
+		y->left = z->left;
+		if (y != z->right) {
+			x_parent = y->parent;
+			if (x)
+				x->parent = y->parent;
+			y->parent->left = x;
+			y->right = z->right;
+			z->right->parent = y;
+		} else
+			x_parent = y;
+		if (root == z)
+			root = y;
+		else if (z->parent->left == z)
+			z->parent->left = y;
+		else
+			z->parent->right = y;
+		y->parent = z->parent;
+		Policy::replace(z, y);
+
+		rb_color tmp = y->color;
+		y->color = z->color;
+		z->color = tmp;
+		y = z;
+	} else {
+		x_parent = y->parent;
+		if (x)
+			x->parent = y->parent;
+		if (root == z)
+			root = x;
+		else if (z->parent->left == z)
+			z->parent->left = x;
+		else
+			z->parent->right = x;
+	}
+
+	if (y->color == rb_red)
+		return y;
+
+	while (x != root && (!x || x->color == rb_black)) {
+		if (x == x_parent->left) {
+			rb_node_base *w = x_parent->right;
+
+			if (w->color == rb_red) {
+				w->color = rb_black;
+				x_parent->color = rb_red;
+				rb_rotate_left<Policy>(x_parent, root);
+				w = x_parent->right;
+			}
+			if ((!w->left || w->left->color == rb_black)
+				&& (!w->right || w->right->color == rb_black)) {
+				w->color = rb_red;
+				x = x_parent;
+				x_parent = x_parent->parent;
+			} else {
+				if (!w->right || w->right->color == rb_black) {
+					w->left->color = rb_black;
+					w->color = rb_red;
+					rb_rotate_right<Policy>(w, root);
+					w = x_parent->right;
+				}
+				w->color = x_parent->color;
+				x_parent->color = rb_black;
+				if (w->right)
+					w->right->color = rb_black;
+				rb_rotate_left<Policy>(x_parent, root);
+				break;
+			}
+		} else {
+			rb_node_base *w = x_parent->left;
+
+			if (w->color == rb_red) {
+				w->color = rb_black;
+				x_parent->color = rb_red;
+				rb_rotate_right<Policy>(x_parent, root);
+				w = x_parent->left;
+			}
+			if ((!w->right || w->right->color == rb_black)
+				&& (!w->left || w->left->color == rb_black)) {
+				w->color = rb_red;
+				x = x_parent;
+				x_parent = x_parent->parent;
+			} else {
+				if (!w->left || w->left->color == rb_black) {
+					w->right->color = rb_black;
+					w->color = rb_red;
+					rb_rotate_left<Policy>(w, root);
+					w = x_parent->left;
+				}
+				w->color = x_parent->color;
+				x_parent->color = rb_black;
+				if (w->left)
+					w->left->color = rb_black;
+				rb_rotate_right<Policy>(x_parent, root);
+				break;
+			}
+		}
+	}
+	if (x)
+		x->color = rb_black;
+	return y;
+}
+
+/* Number of black nodes on a path from x down to a leaf. */
+inline size_t rb_black_height(rb_node_base const *x)
+{
+	size_t h = 0;
+
+	for (; x; x = x->left)
+		h += x->color == rb_black;
+	return h;
+}
+
+/* Number of links from x up to the root. x must not be the header. */
+inline size_t rb_depth(rb_node_base const *x)
+{
+	size_t d = 0;
+
+	/* the root is the black node that is the parent of its parent */
+	for (; x->color != rb_black || x->parent->parent != x; x = x->parent)
+		++d;
+	return d;
+}
+
+/* Returns the highest node of the tree in [a,b], where a does not go
+ * after b: the range is in the subtree of that node, on both sides of
+ * it. Splitting a range there, then the two halves the same way, goes
+ * no deeper than the height of the tree.
+ */
+inline rb_node_base *rb_split_point(rb_node_base *a, rb_node_base *b)
+{
+	size_t da = rb_depth(a);
+	size_t db = rb_depth(b);
+
+	for (; da > db; --da)
+		a = a->parent;
+	for (; db > da; --db)
+		b = b->parent;
+	while (a != b) {
+		a = a->parent;
+		b = b->parent;
+	}
+	return a;
+}
+
+/* Joins the trees l and r, whose black heights are lh and rh, with the
+ * node k in between: every node of l goes before k and every node of r
+ * after it. The roots have no parent. Returns the root of the joined
+ * tree and stores its black height in h.
+ *
+ * k is linked on the spine of the taller tree where the black height
+ * matches the other tree, so this is O(|lh - rh| + 1). The list links
+ * are not touched.
+ */
+template <typename Policy>
+rb_node_base *rb_join(
+	rb_node_base *l,
+	size_t lh,
+	rb_node_base *k,
+	rb_node_base *r,
+	size_t rh,
+	size_t &h)
+{
+	if (l && l->color == rb_red) {
+		l->color = rb_black;
+		++lh;
+	}
+	if (r && r->color == rb_red) {
+		r->color = rb_black;
+		++rh;
+	}
+	if (lh == rh) {
+		k->parent = 0;
+		k->left = l;
+		k->right = r;
+		k->color = rb_black;
+		if (l)
+			l->parent = k;
+		if (r)
+			r->parent = k;
+		Policy::update(k);
+		h = lh + 1;
+		return k;
+	}
+
+	bool			right_spine = lh > rh;
+	rb_node_base	*root = right_spine ? l : r;
+	rb_node_base	*p = 0;
+	rb_node_base	*c = root;
+
+	/* find the first black node of the spine as tall as the other tree */
+	h = right_spine ? lh : rh;
+	for (size_t low = right_spine ? rh : lh; c && (c->color == rb_red || h > low); ) {
+		h -= c->color == rb_black;
+		p = c;
+		c = right_spine ? c->right : c->left;
+	}
+	h = right_spine ? lh : rh;
+
+	k->parent = p;
+	k->color = rb_red;
+	if (right_spine) {
+		p->right = k;
+		k->left = c;
+		k->right = r;
+	} else {
+		p->left = k;
+		k->left = l;
+		k->right = c;
+	}
+	if (k->left)
+		k->left->parent = k;
+	if (k->right)
+		k->right->parent = k;
+	for (rb_node_base *n = k; n; n = n->parent)
+		Policy::update(n);
+
+	rb_rebalance_after_insert<Policy>(k, root);
+	if (root->color == rb_red) {
+		root->color = rb_black;
+		++h;
+	}
+	return root;
+}
+
+/*------------------------------------------------------------*/
+/*--- Iterator                                             ---*/
+/*------------------------------------------------------------*/
+
+/* Bidirectional iterator over the nodes of a red-black tree.
+ * Value is const qualified for const iterators.
+ */
+template <typename Node, typename Value>
+class rb_tree_iterator
+{
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef std::bidirectional_iterator_tag	iterator_category;
+		typedef Value							value_type;
+		typedef Value *							pointer;
+		typedef Value &							reference;
+		typedef std::ptrdiff_t					difference_type;
+
+	private:
+		rb_node_base	*_node;
+
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member functions                                     ---*/
+	/*------------------------------------------------------------*/
+
+		rb_tree_iterator(void) : _node(0) { }
+
+		explicit rb_tree_iterator(rb_node_base const *node)
+			: _node(const_cast<rb_node_base *>(node))
+		{ }
+
+		/* Converts an iterator to a const iterator, never the other way.
+		 * For an iterator this is the copy constructor.
+		 */
+		rb_tree_iterator(rb_tree_iterator<Node, typename remove_const<Value>::type> const &other)
+			: _node(other.node())
+		{ }
+
+		reference	operator*() const	{ return static_cast<Node *>(_node)->value; }
+		pointer		operator->() const	{ return &static_cast<Node *>(_node)->value; }
+
+		rb_tree_iterator	&operator++()		{ _node = rb_increment(_node); return *this; }
+		rb_tree_iterator	&operator--()		{ _node = rb_decrement(_node); return *this; }
+		rb_tree_iterator	operator++(int)		{ rb_tree_iterator tmp(*this); _node = rb_increment(_node); return tmp; }
+		rb_tree_iterator	operator--(int)		{ rb_tree_iterator tmp(*this); _node = rb_decrement(_node); return tmp; }
+
+		rb_node_base		*node(void) const	{ return _node; }
+};
+
+template <typename Node, typename V1, typename V2>
+bool operator==(
+	rb_tree_iterator<Node, V1> const &lhs,
+	rb_tree_iterator<Node, V2> const &rhs) { return lhs.node() == rhs.node(); }
+
+template <typename Node, typename V1, typename V2>
+bool operator!=(
+	rb_tree_iterator<Node, V1> const &lhs,
+	rb_tree_iterator<Node, V2> const &rhs) { return lhs.node() != rhs.node(); }
+
+} /* namespace: ft */
+
+#endif /* __RB_TREE_HPP__ */
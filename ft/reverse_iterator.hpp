@@ -48,9 +48,6 @@ class reverse_iterator
 		template <class U>
 		reverse_iterator(const reverse_iterator<U> &other) : _current(other.base()) { }
 
-		/* destroys the iterator */
-		virtual ~reverse_iterator(void) { };
-
 		/* The underlying iterator is assigned the value of the underlying iterator of other,
 		 * i.e. other.base()
 		 */
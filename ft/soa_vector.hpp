@@ -0,0 +1,508 @@
+/* soa_vector.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __SOA_VECTOR_HPP__
+# define __SOA_VECTOR_HPP__
+
+# include "vector.hpp"
+# include "pair.hpp"
+# include "equal.hpp"
+# include "type_traits.hpp"
+# include "reverse_iterator.hpp"
+# include <iterator>
+# include <memory>
+# include <stdexcept>
+# include <stddef.h>
+# include <assert.h>
+
+namespace ft
+{
+
+/*------------------------------------------------------------*/
+/*--- Column span                                          ---*/
+/*------------------------------------------------------------*/
+
+/* Contiguous run of size objects of type T, the storage of one column of
+ * a soa_vector. Loops over it are plain pointer loops, which the compiler
+ * can vectorize. It is invalidated like the iterators of the vector.
+ */
+template <typename T>
+class soa_span
+{
+	public:
+		typedef T			element_type;
+		typedef T			*iterator;
+		typedef size_t		size_type;
+
+	private:
+		T			*_data;
+		size_type	_size;
+
+	public:
+		soa_span(T *data, size_type size) : _data(data), _size(size) { }
+
+		T			*data(void) const	{ return _data; }
+		size_type	size(void) const	{ return _size; }
+		bool		empty(void) const	{ return _size == 0; }
+		iterator	begin(void) const	{ return _data; }
+		iterator	end(void) const		{ return _data + _size; }
+
+		T &operator[](size_type n) const { assert(n < _size); return _data[n]; }
+};
+
+/*------------------------------------------------------------*/
+/*--- Proxy reference                                      ---*/
+/*------------------------------------------------------------*/
+
+/* Stands for the element of a soa_vector at one index: first and second
+ * refer to its slots in the two columns. Assigning to it assigns the
+ * slots, and it converts to the ft::pair it stands for, so that
+ * algorithms that copy elements out (as std::sort does) work on it.
+ */
+template <typename T1, typename T2>
+struct soa_reference
+{
+	typedef ft::pair<typename remove_const<T1>::type, typename remove_const<T2>::type>	value_type;
+
+	T1	&first;
+	T2	&second;
+
+	soa_reference(T1 &a, T2 &b) : first(a), second(b) { }
+
+	/* Converts a reference to a const reference. */
+	template <typename U1, typename U2>
+	soa_reference(soa_reference<U1, U2> const &other)
+		: first(other.first)
+		, second(other.second)
+	{ }
+
+	operator value_type(void) const { return value_type(first, second); }
+
+	soa_reference &operator=(soa_reference const &x)
+	{
+		first = x.first;
+		second = x.second;
+		return *this;
+	}
+
+	template <typename U1, typename U2>
+	soa_reference &operator=(soa_reference<U1, U2> const &x)
+	{
+		first = x.first;
+		second = x.second;
+		return *this;
+	}
+
+	template <typename U1, typename U2>
+	soa_reference &operator=(ft::pair<U1, U2> const &x)
+	{
+		first = x.first;
+		second = x.second;
+		return *this;
+	}
+};
+
+/* Swaps the elements the references stand for. */
+template <typename T1, typename T2>
+void swap(soa_reference<T1, T2> x, soa_reference<T1, T2> y)
+{
+	std::swap(x.first, y.first);
+	std::swap(x.second, y.second);
+}
+
+/* Compare the elements as ft::pair does. */
+template <typename T1, typename T2, typename U1, typename U2>
+bool operator==(soa_reference<T1, T2> const &x, soa_reference<U1, U2> const &y)
+{
+	return x.first == y.first && x.second == y.second;
+}
+
+template <typename T1, typename T2, typename U1, typename U2>
+bool operator!=(soa_reference<T1, T2> const &x, soa_reference<U1, U2> const &y) { return !(x == y); }
+
+template <typename T1, typename T2, typename U1, typename U2>
+bool operator<(soa_reference<T1, T2> const &x, soa_reference<U1, U2> const &y)
+{
+	return x.first < y.first || (!(y.first < x.first) && x.second < y.second);
+}
+
+/* Comparisons with a pair, for algorithms that hold a copy of an
+ * element, such as the insertion step of std::sort.
+ */
+template <typename T1, typename T2, typename U1, typename U2>
+bool operator==(soa_reference<T1, T2> const &x, ft::pair<U1, U2> const &y)
+{
+	return x.first == y.first && x.second == y.second;
+}
+
+template <typename T1, typename T2, typename U1, typename U2>
+bool operator==(ft::pair<U1, U2> const &x, soa_reference<T1, T2> const &y) { return y == x; }
+
+template <typename T1, typename T2, typename U1, typename U2>
+bool operator<(soa_reference<T1, T2> const &x, ft::pair<U1, U2> const &y)
+{
+	return x.first < y.first || (!(y.first < x.first) && x.second < y.second);
+}
+
+template <typename T1, typename T2, typename U1, typename U2>
+bool operator<(ft::pair<U1, U2> const &x, soa_reference<T1, T2> const &y)
+{
+	return x.first < y.first || (!(y.first < x.first) && x.second < y.second);
+}
+
+template <typename T1, typename T2, typename U1, typename U2>
+bool operator>(soa_reference<T1, T2> const &x, soa_reference<U1, U2> const &y) { return y < x; }
+
+template <typename T1, typename T2, typename U1, typename U2>
+bool operator<=(soa_reference<T1, T2> const &x, soa_reference<U1, U2> const &y) { return !(y < x); }
+
+template <typename T1, typename T2, typename U1, typename U2>
+bool operator>=(soa_reference<T1, T2> const &x, soa_reference<U1, U2> const &y) { return !(x < y); }
+
+/*------------------------------------------------------------*/
+/*--- Iterator                                             ---*/
+/*------------------------------------------------------------*/
+
+/* Random access iterator over the two columns of a soa_vector, T1 and T2
+ * are const qualified for const iterators. Dereferencing it gives a
+ * soa_reference by value.
+ */
+template <typename T1, typename T2>
+class soa_iterator
+{
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef std::random_access_iterator_tag						iterator_category;
+		typedef soa_reference<T1, T2>								reference;
+		typedef typename reference::value_type						value_type;
+		typedef std::ptrdiff_t										difference_type;
+
+		/* what operator-> returns: it holds the reference */
+		struct pointer
+		{
+			reference	ref;
+
+			explicit pointer(reference r) : ref(r) { }
+			reference *operator->(void) { return &ref; }
+		};
+
+	private:
+		T1	*_first;
+		T2	*_second;
+
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member functions                                     ---*/
+	/*------------------------------------------------------------*/
+
+		soa_iterator(void) : _first(0), _second(0) { }
+		soa_iterator(T1 *a, T2 *b) : _first(a), _second(b) { }
+
+		/* Converts an iterator to a const iterator. */
+		template <typename U1, typename U2>
+		soa_iterator(soa_iterator<U1, U2> const &other)
+			: _first(other.first_base())
+			, _second(other.second_base())
+		{ }
+
+		T1	*first_base(void) const		{ return _first; }
+		T2	*second_base(void) const	{ return _second; }
+
+		reference	operator*(void) const						{ return reference(*_first, *_second); }
+		pointer		operator->(void) const						{ return pointer(**this); }
+		reference	operator[](difference_type n) const			{ return reference(_first[n], _second[n]); }
+
+		soa_iterator	&operator++(void)						{ ++_first; ++_second; return *this; }
+		soa_iterator	&operator--(void)						{ --_first; --_second; return *this; }
+		soa_iterator	operator++(int)							{ soa_iterator tmp(*this); ++*this; return tmp; }
+		soa_iterator	operator--(int)							{ soa_iterator tmp(*this); --*this; return tmp; }
+		soa_iterator	&operator+=(difference_type n)			{ _first += n; _second += n; return *this; }
+		soa_iterator	&operator-=(difference_type n)			{ _first -= n; _second -= n; return *this; }
+		soa_iterator	operator+(difference_type n) const		{ return soa_iterator(_first + n, _second + n); }
+		soa_iterator	operator-(difference_type n) const		{ return soa_iterator(_first - n, _second - n); }
+};
+
+template <typename T1, typename T2>
+soa_iterator<T1, T2> operator+(
+	typename soa_iterator<T1, T2>::difference_type n,
+	soa_iterator<T1, T2> const &it) { return it + n; }
+
+/* Iterators over the same vector differ by the same amount in both
+ * columns, so the first one is enough to compare them.
+ */
+template <typename T1, typename T2, typename U1, typename U2>
+typename soa_iterator<T1, T2>::difference_type operator-(
+	soa_iterator<T1, T2> const &x,
+	soa_iterator<U1, U2> const &y) { return x.first_base() - y.first_base(); }
+
+template <typename T1, typename T2, typename U1, typename U2>
+bool operator==(soa_iterator<T1, T2> const &x, soa_iterator<U1, U2> const &y) { return x.first_base() == y.first_base(); }
+
+template <typename T1, typename T2, typename U1, typename U2>
+bool operator!=(soa_iterator<T1, T2> const &x, soa_iterator<U1, U2> const &y) { return x.first_base() != y.first_base(); }
+
+template <typename T1, typename T2, typename U1, typename U2>
+bool operator<(soa_iterator<T1, T2> const &x, soa_iterator<U1, U2> const &y) { return x.first_base() < y.first_base(); }
+
+template <typename T1, typename T2, typename U1, typename U2>
+bool operator>(soa_iterator<T1, T2> const &x, soa_iterator<U1, U2> const &y) { return y < x; }
+
+template <typename T1, typename T2, typename U1, typename U2>
+bool operator<=(soa_iterator<T1, T2> const &x, soa_iterator<U1, U2> const &y) { return !(y < x); }
+
+template <typename T1, typename T2, typename U1, typename U2>
+bool operator>=(soa_iterator<T1, T2> const &x, soa_iterator<U1, U2> const &y) { return !(x < y); }
+
+/*------------------------------------------------------------*/
+/*--- Structure of arrays vector                           ---*/
+/*------------------------------------------------------------*/
+
+/* Sequence of ft::pair<T1, T2> that stores the first members in one
+ * array and the second members in another, so that a scan over one
+ * member reads no byte of the other: a loop over the keys of pairs of
+ * two 8-byte members touches half the cache lines it does in a vector of
+ * pairs.
+ *
+ * The elements have no address of their own: the iterators and
+ * operator[] return soa_reference proxies, and first_column and
+ * second_column give each array as a soa_span.
+ */
+template <
+	typename T1,
+	typename T2,
+	typename Allocator = std::allocator<ft::pair<T1, T2> > >
+class soa_vector
+{
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef ft::pair<T1, T2>									value_type;
+		typedef T1													first_type;
+		typedef T2													second_type;
+		typedef Allocator											allocator_type;
+		typedef soa_reference<T1, T2>								reference;
+		typedef soa_reference<T1 const, T2 const>					const_reference;
+		typedef soa_iterator<T1, T2>								iterator;
+		typedef soa_iterator<T1 const, T2 const>					const_iterator;
+		typedef ft::reverse_iterator<iterator>						reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>				const_reverse_iterator;
+		typedef std::ptrdiff_t										difference_type;
+		typedef size_t												size_type;
+
+	private:
+		typedef typename Allocator::template rebind<T1>::other		first_allocator;
+		typedef typename Allocator::template rebind<T2>::other		second_allocator;
+
+		ft::vector<T1, first_allocator>		_first;
+		ft::vector<T2, second_allocator>	_second;
+
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Construct                                            ---*/
+	/*------------------------------------------------------------*/
+
+		explicit soa_vector(allocator_type const &alloc = allocator_type())
+			: _first(first_allocator(alloc))
+			, _second(second_allocator(alloc))
+		{ }
+
+		/* Constructs a vector of n copies of val. */
+		explicit soa_vector(
+			size_type n,
+			value_type const &val = value_type(),
+			allocator_type const &alloc = allocator_type())
+			: _first(n, val.first, first_allocator(alloc))
+			, _second(n, val.second, second_allocator(alloc))
+		{ }
+
+		/* Constructs a vector with the elements of [first,last), which
+		 * convert to value_type.
+		 */
+		template <class InputIterator>
+		soa_vector(
+			InputIterator first,
+			InputIterator last,
+			allocator_type const &alloc = allocator_type(),
+			typename ft::enable_if< !ft::is_integral<InputIterator>::value >::type* = 0)
+			: _first(first_allocator(alloc))
+			, _second(second_allocator(alloc))
+		{
+			for (; first != last; ++first)
+				push_back(*first);
+		}
+
+		allocator_type get_allocator(void) const { return allocator_type(_first.get_allocator()); }
+
+	/*------------------------------------------------------------*/
+	/*--- Iterators                                            ---*/
+	/*------------------------------------------------------------*/
+
+		iterator				begin(void)				{ return iterator(_data_first(), _data_second()); }
+		const_iterator			begin(void) const		{ return const_iterator(_data_first(), _data_second()); }
+		iterator				end(void)				{ return begin() + size(); }
+		const_iterator			end(void) const			{ return begin() + size(); }
+		reverse_iterator		rbegin(void)			{ return reverse_iterator(end()); }
+		const_reverse_iterator	rbegin(void) const		{ return const_reverse_iterator(end()); }
+		reverse_iterator		rend(void)				{ return reverse_iterator(begin()); }
+		const_reverse_iterator	rend(void) const		{ return const_reverse_iterator(begin()); }
+
+	/*------------------------------------------------------------*/
+	/*--- Capacity                                             ---*/
+	/*------------------------------------------------------------*/
+
+		size_type	size(void) const		{ return _first.size(); }
+		bool		empty(void) const		{ return _first.empty(); }
+		size_type	capacity(void) const	{ return _first.capacity(); }
+
+		size_type max_size(void) const
+		{
+			return _first.max_size() < _second.max_size() ? _first.max_size() : _second.max_size();
+		}
+
+		void reserve(size_type n)
+		{
+			_first.reserve(n);
+			_second.reserve(n);
+		}
+
+		void resize(size_type n, value_type const &val = value_type())
+		{
+			size_type old_size = size();
+
+			_first.resize(n, val.first);
+			try {
+				_second.resize(n, val.second);
+			} catch (...) {
+				/* only growing constructs anything, so only it throws */
+				_first.erase(_first.begin() + old_size, _first.end());
+				throw;
+			}
+		}
+
+	/*------------------------------------------------------------*/
+	/*--- Element access                                       ---*/
+	/*------------------------------------------------------------*/
+
+		reference		operator[](size_type n)			{ return reference(_first[n], _second[n]); }
+		const_reference	operator[](size_type n) const	{ return const_reference(_first[n], _second[n]); }
+
+		reference at(size_type n)
+		{
+			if (n >= size())
+				throw std::out_of_range("index out of range");
+			return (*this)[n];
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= size())
+				throw std::out_of_range("index out of range");
+			return (*this)[n];
+		}
+
+		reference		front(void)			{ assert(!empty()); return (*this)[0]; }
+		const_reference	front(void) const	{ assert(!empty()); return (*this)[0]; }
+		reference		back(void)			{ assert(!empty()); return (*this)[size() - 1]; }
+		const_reference	back(void) const	{ assert(!empty()); return (*this)[size() - 1]; }
+
+		/* The arrays of the first and of the second members. */
+		soa_span<T1>		first_column(void)			{ return soa_span<T1>(_data_first(), size()); }
+		soa_span<T1 const>	first_column(void) const	{ return soa_span<T1 const>(_data_first(), size()); }
+		soa_span<T2>		second_column(void)			{ return soa_span<T2>(_data_second(), size()); }
+		soa_span<T2 const>	second_column(void) const	{ return soa_span<T2 const>(_data_second(), size()); }
+
+	/*------------------------------------------------------------*/
+	/*--- Modifiers                                            ---*/
+	/*------------------------------------------------------------*/
+
+		void push_back(value_type const &x) { push_back(x.first, x.second); }
+
+		void push_back(T1 const &a, T2 const &b)
+		{
+			_first.push_back(a);
+			try {
+				_second.push_back(b);
+			} catch (...) {
+				_first.pop_back();
+				throw;
+			}
+		}
+
+		void pop_back(void)
+		{
+			assert(!empty());
+			_first.pop_back();
+			_second.pop_back();
+		}
+
+		/* Inserts x before position. */
+		iterator insert(const_iterator position, value_type const &x)
+		{
+			size_type i = position - begin();
+
+			assert(i <= size());
+			_first.insert(_first.begin() + i, x.first);
+			try {
+				_second.insert(_second.begin() + i, x.second);
+			} catch (...) {
+				_first.erase(_first.begin() + i);
+				throw;
+			}
+			return begin() + i;
+		}
+
+		iterator erase(const_iterator position) { return erase(position, position + 1); }
+
+		/* Removes the elements in [first,last). */
+		iterator erase(const_iterator first, const_iterator last)
+		{
+			size_type i = first - begin();
+			size_type j = last - begin();
+
+			assert(i <= j && j <= size());
+			_first.erase(_first.begin() + i, _first.begin() + j);
+			_second.erase(_second.begin() + i, _second.begin() + j);
+			return begin() + i;
+		}
+
+		void clear(void)
+		{
+			_first.clear();
+			_second.clear();
+		}
+
+		void swap(soa_vector &x)
+		{
+			_first.swap(x._first);
+			_second.swap(x._second);
+		}
+
+	private:
+		T1			*_data_first(void)			{ return empty() ? 0 : &_first[0]; }
+		T1 const	*_data_first(void) const	{ return empty() ? 0 : &_first[0]; }
+		T2			*_data_second(void)			{ return empty() ? 0 : &_second[0]; }
+		T2 const	*_data_second(void) const	{ return empty() ? 0 : &_second[0]; }
+};
+
+template <typename T1, typename T2, typename Allocator>
+bool operator==(soa_vector<T1, T2, Allocator> const &x, soa_vector<T1, T2, Allocator> const &y)
+{
+	return x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin());
+}
+
+template <typename T1, typename T2, typename Allocator>
+bool operator!=(soa_vector<T1, T2, Allocator> const &x, soa_vector<T1, T2, Allocator> const &y) { return !(x == y); }
+
+template <typename T1, typename T2, typename Allocator>
+void swap(soa_vector<T1, T2, Allocator> &x, soa_vector<T1, T2, Allocator> &y) { x.swap(y); }
+
+} /* namespace: ft */
+
+#endif /* __SOA_VECTOR_HPP__ */
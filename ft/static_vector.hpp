@@ -0,0 +1,399 @@
+/* static_vector.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __STATIC_VECTOR_HPP__
+# define __STATIC_VECTOR_HPP__
+
+# include "iterator_traits.hpp"
+# include "lexicographical_compare.hpp"
+# include "reverse_iterator.hpp"
+# include "equal.hpp"
+# include "type_traits.hpp"
+# include <algorithm>
+# include <stdexcept>
+# include <new>
+# include <stddef.h>
+# include <assert.h>
+
+namespace ft
+{
+
+/* Storage of a static_vector: the number of live elements followed by
+ * room for N elements. Only the first _size slots hold constructed objects.
+ *
+ * When T is trivially copyable the storage declares no copy operation and
+ * no destructor, so the static_vector is trivially copyable as well.
+ */
+template <typename T, size_t N, bool Trivial = is_trivially_copyable<T>::value>
+class static_vector_storage
+{
+	protected:
+		size_t														_size;
+		typename aligned_storage<sizeof(T) * N, alignment_of<T>::value>::type	_storage;
+
+		static_vector_storage(void) : _size(0) { }
+
+		T		*_data(void)		{ return reinterpret_cast<T *>(_storage.data); }
+		T const	*_data(void) const	{ return reinterpret_cast<T const *>(_storage.data); }
+};
+
+template <typename T, size_t N>
+class static_vector_storage<T, N, false>
+{
+	protected:
+		size_t														_size;
+		typename aligned_storage<sizeof(T) * N, alignment_of<T>::value>::type	_storage;
+
+		static_vector_storage(void) : _size(0) { }
+
+		/* The destructor does not run if a copy throws, so the elements
+		 * already copied are destroyed here.
+		 */
+		static_vector_storage(static_vector_storage const &x) : _size(0)
+		{
+			try {
+				for (; _size < x._size; ++_size)
+					::new (_data() + _size) T(x._data()[_size]);
+			} catch (...) {
+				while (_size)
+					_data()[--_size].~T();
+				throw ;
+			}
+		}
+
+		~static_vector_storage(void)
+		{
+			while (_size)
+				_data()[--_size].~T();
+		}
+
+		static_vector_storage &operator=(static_vector_storage const &x)
+		{
+			if (this == &x)
+				return *this;
+
+			size_t i = 0;
+
+			for (; i < _size && i < x._size; ++i)
+				_data()[i] = x._data()[i];
+			for (; _size > x._size; )
+				_data()[--_size].~T();
+			for (; _size < x._size; ++_size)
+				::new (_data() + _size) T(x._data()[_size]);
+			return *this;
+		}
+
+		T		*_data(void)		{ return reinterpret_cast<T *>(_storage.data); }
+		T const	*_data(void) const	{ return reinterpret_cast<T const *>(_storage.data); }
+};
+
+/* A vector with a capacity of N elements fixed at compile time.
+ *
+ * The elements are stored inline, so a static_vector never allocates and
+ * can live on the stack or inside another object. Growing past N throws
+ * std::length_error.
+ */
+template <typename T, size_t N>
+class static_vector : public static_vector_storage<T, N>
+{
+	private:
+		typedef static_vector_storage<T, N>	storage;
+
+		using storage::_size;
+		using storage::_data;
+
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef T										value_type;
+		typedef T *										pointer;
+		typedef T const *								const_pointer;
+		typedef T &										reference;
+		typedef T const &								const_reference;
+		typedef T *										iterator;
+		typedef T const *								const_iterator;
+		typedef ft::reverse_iterator<iterator>			reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+		typedef typename iterator_traits<iterator>::difference_type	difference_type;
+		typedef size_t									size_type;
+
+	/*------------------------------------------------------------*/
+	/*--- Construct/copy/destroy                               ---*/
+	/*------------------------------------------------------------*/
+
+		/* Constructs an empty container, with no elements. */
+		static_vector(void) { }
+
+		/* Constructs a container with n elements.
+		 * Each element is a copy of value.
+		 */
+		explicit static_vector(size_type n, value_type const &value = value_type())
+		{ assign(n, value); }
+
+		/* Constructs a container with as many elements as the
+		 * range [first,last).
+		 */
+		template <class InputIterator>
+		static_vector(
+			InputIterator first,
+			InputIterator last,
+			typename ft::enable_if< !ft::is_integral<InputIterator>::value >::type* = 0)
+		{ assign(first, last); }
+
+		template <class InputIterator>
+		void assign(
+			InputIterator first,
+			InputIterator last,
+			typename ft::enable_if< !ft::is_integral<InputIterator>::value >::type* = 0)
+		{
+			clear();
+			while (first != last)
+				push_back(*first++);
+		}
+
+		void assign(size_type n, value_type const &value)
+		{
+			clear();
+			insert(end(), n, value);
+		}
+
+	/*------------------------------------------------------------*/
+	/*--- Iterators                                            ---*/
+	/*------------------------------------------------------------*/
+
+		iterator		begin(void)			{ return _data(); }
+		const_iterator	begin(void) const	{ return _data(); }
+		iterator		end(void)			{ return _data() + _size; }
+		const_iterator	end(void) const		{ return _data() + _size; }
+
+		reverse_iterator		rbegin(void)		{ return reverse_iterator(end()); }
+		const_reverse_iterator	rbegin(void) const	{ return const_reverse_iterator(end()); }
+		reverse_iterator		rend(void)			{ return reverse_iterator(begin()); }
+		const_reverse_iterator	rend(void) const	{ return const_reverse_iterator(begin()); }
+
+	/*------------------------------------------------------------*/
+	/*--- Capacity                                             ---*/
+	/*------------------------------------------------------------*/
+
+		size_type	size(void) const		{ return _size; }
+		size_type	capacity(void) const	{ return N; }
+		size_type	max_size(void) const	{ return N; }
+		bool		empty(void) const		{ return _size == 0; }
+		bool		full(void) const		{ return _size == N; }
+
+		/* Only checks that n elements fit: the storage is always there. */
+		void reserve(size_type n) const { _check(n); }
+
+		/* Resizes the container so that it contains n elements. */
+		void resize(size_type n, value_type const &value = value_type())
+		{
+			_check(n);
+			while (_size > n)
+				pop_back();
+			while (_size < n)
+				push_back(value);
+		}
+
+	/*------------------------------------------------------------*/
+	/*--- Element access                                       ---*/
+	/*------------------------------------------------------------*/
+
+		reference		operator[](size_type n)			{ return _data()[n]; }
+		const_reference	operator[](size_type n) const	{ return _data()[n]; }
+
+		reference at(size_type n)
+		{
+			if (n >= _size)
+				throw std::out_of_range("index out of range");
+			return _data()[n];
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= _size)
+				throw std::out_of_range("index out of range");
+			return _data()[n];
+		}
+
+		reference		front(void)			{ assert(!empty()); return *_data(); }
+		const_reference	front(void) const	{ assert(!empty()); return *_data(); }
+		reference		back(void)			{ assert(!empty()); return _data()[_size - 1]; }
+		const_reference	back(void) const	{ assert(!empty()); return _data()[_size - 1]; }
+
+		pointer			data(void)			{ return _data(); }
+		const_pointer	data(void) const	{ return _data(); }
+
+	/*------------------------------------------------------------*/
+	/*--- Modifiers                                            ---*/
+	/*------------------------------------------------------------*/
+
+		void push_back(value_type const &x)
+		{
+			_check(_size + 1);
+			::new (_data() + _size) T(x);
+			++_size;
+		}
+
+		void pop_back(void)
+		{
+			assert(!empty());
+			_data()[--_size].~T();
+		}
+
+		/* The new elements are built past the end, then rotated into
+		 * place. If building one throws, the container is left unchanged;
+		 * if moving the old elements throws, they all stay in the
+		 * container but in an unspecified order, as with ft::vector.
+		 */
+		iterator insert(iterator position, value_type const &x)
+		{
+			size_type offset = position - begin();
+
+			insert(position, 1, x);
+			return begin() + offset;
+		}
+
+		void insert(iterator position, size_type n, value_type const &x)
+		{
+			/* check if 'position' is in this vector */
+			assert(position >= begin() && position <= end());
+			_check(_size + n);
+
+			size_type offset = position - begin();
+			size_type old_size = _size;
+
+			try {
+				for (; n; --n)
+					push_back(x);
+			} catch (...) {
+				_truncate(old_size);
+				throw;
+			}
+			std::rotate(begin() + offset, begin() + old_size, end());
+		}
+
+		/* Reads [first,last) once, so single-pass iterators work too. */
+		template <class InputIterator>
+		void insert(
+			iterator position,
+			InputIterator first,
+			InputIterator last,
+			typename ft::enable_if< !ft::is_integral<InputIterator>::value >::type* = 0)
+		{
+			/* check if 'position' is in this vector */
+			assert(position >= begin() && position <= end());
+
+			size_type offset = position - begin();
+			size_type old_size = _size;
+
+			try {
+				for (; first != last; ++first)
+					push_back(*first);
+			} catch (...) {
+				_truncate(old_size);
+				throw;
+			}
+			std::rotate(begin() + offset, begin() + old_size, end());
+		}
+
+		iterator erase(iterator position) { return erase(position, position + 1); }
+
+		/* Removes [first,last) by shifting the tail down. */
+		iterator erase(iterator first, iterator last)
+		{
+			/* check if 'first' to 'last' is in this vector */
+			assert(first >= begin() && first <= last && last <= end());
+
+			iterator dst = first;
+
+			for (iterator src = last; src != end(); ++src, ++dst)
+				*dst = *src;
+			while (end() != dst)
+				pop_back();
+			return first;
+		}
+
+		void swap(static_vector &x)
+		{
+			static_vector tmp(*this);
+
+			*this = x;
+			x = tmp;
+		}
+
+		void clear(void)
+		{
+			while (_size)
+				pop_back();
+		}
+
+	private:
+		static void _check(size_type n)
+		{
+			if (n > N)
+				throw std::length_error("static_vector capacity exceeded");
+		}
+
+		/* Destroys the elements past the first n. */
+		void _truncate(size_type n)
+		{
+			while (_size > n)
+				pop_back();
+		}
+};
+
+/*------------------------------------------------------------*/
+/*--- Non member functions                                 ---*/
+/*------------------------------------------------------------*/
+
+template <class T, size_t N>
+inline bool operator==(
+	static_vector<T, N> const &x,
+	static_vector<T, N> const &y)
+{
+	return x.size() == y.size()
+		&& ft::equal(x.begin(), x.end(), y.begin());
+}
+
+template <class T, size_t N>
+inline bool operator!=(
+	static_vector<T, N> const &x,
+	static_vector<T, N> const &y) { return !(x == y); }
+
+template <class T, size_t N>
+inline bool operator<(
+	static_vector<T, N> const &x,
+	static_vector<T, N> const &y)
+{
+	return ft::lexicographical_compare(
+		x.begin(), x.end(),
+		y.begin(), y.end());
+}
+
+template <class T, size_t N>
+inline bool operator>(
+	static_vector<T, N> const &x,
+	static_vector<T, N> const &y) { return y < x; }
+
+template <class T, size_t N>
+inline bool operator>=(
+	static_vector<T, N> const &x,
+	static_vector<T, N> const &y) { return !(x < y); }
+
+template <class T, size_t N>
+inline bool operator<=(
+	static_vector<T, N> const &x,
+	static_vector<T, N> const &y) { return !(y < x); }
+
+template <class T, size_t N>
+void swap(
+	static_vector<T, N> &x,
+	static_vector<T, N> &y) { x.swap(y); }
+
+} /* namespace: ft */
+
+#endif /* __STATIC_VECTOR_HPP__ */
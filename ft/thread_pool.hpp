@@ -0,0 +1,268 @@
+/* thread_pool.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __THREAD_POOL_HPP__
+# define __THREAD_POOL_HPP__
+
+# include "vector.hpp"
+# include <stddef.h>
+# include <assert.h>
+# include <pthread.h>
+# include <sched.h>
+# include <unistd.h>
+
+namespace ft
+{
+
+/* A piece of work for a thread_pool: run(job, first, last). What first
+ * and last stand for is up to run, such as a range of indices.
+ */
+struct pool_task
+{
+	void	(*run)(void *job, size_t first, size_t last);
+	void	*job;
+	size_t	first;
+	size_t	last;
+};
+
+/* Work-stealing pool of threads for fork-join parallelism, used by the
+ * parallel algorithms.
+ *
+ * Every worker has a queue of tasks. A thread spawns tasks on its own
+ * queue and runs them from the back, newest first, which keeps the data
+ * it just split warm; an idle worker steals from the front of the other
+ * queues, where the oldest and largest pieces of work are. Threads that
+ * are not workers share one more queue. A thread that waits for its tasks
+ * runs tasks meanwhile, so tasks can spawn and wait for tasks of their
+ * own. Workers with nothing to do sleep.
+ */
+class thread_pool
+{
+	private:
+		struct task_queue
+		{
+			pthread_mutex_t			lock;
+			ft::vector<pool_task>	tasks;
+			size_t					head;	/* tasks before head were stolen */
+
+			task_queue(void) : head(0) { pthread_mutex_init(&lock, 0); }
+			~task_queue(void) { pthread_mutex_destroy(&lock); }
+		};
+
+		struct worker
+		{
+			thread_pool	*pool;
+			size_t		index;
+			pthread_t	thread;
+		};
+
+		size_t			_threads;
+		task_queue		*_queues;	/* one per worker, then the shared one */
+		worker			*_workers;
+		pthread_mutex_t	_lock;		/* for sleeping */
+		pthread_cond_t	_wake;
+		size_t			_queued;	/* tasks in the queues */
+		size_t			_sleeping;
+		bool			_stop;
+
+		thread_pool(thread_pool const &);
+		thread_pool &operator=(thread_pool const &);
+
+	public:
+		/* Starts threads workers. The thread that waits for a task helps,
+		 * so a pool of n - 1 workers keeps n processors busy.
+		 */
+		explicit thread_pool(size_t threads)
+			: _threads(threads)
+			, _queues(new task_queue[threads + 1])
+			, _workers(new worker[threads])
+			, _queued(0)
+			, _sleeping(0)
+			, _stop(false)
+		{
+			pthread_mutex_init(&_lock, 0);
+			pthread_cond_init(&_wake, 0);
+			for (size_t i = 0; i < threads; ++i) {
+				_workers[i].pool = this;
+				_workers[i].index = i;
+				pthread_create(&_workers[i].thread, 0, _main, &_workers[i]);
+			}
+		}
+
+		/* No task may be left. */
+		~thread_pool(void)
+		{
+			pthread_mutex_lock(&_lock);
+			_stop = true;
+			pthread_cond_broadcast(&_wake);
+			pthread_mutex_unlock(&_lock);
+			for (size_t i = 0; i < _threads; ++i)
+				pthread_join(_workers[i].thread, 0);
+			pthread_cond_destroy(&_wake);
+			pthread_mutex_destroy(&_lock);
+			delete[] _workers;
+			delete[] _queues;
+		}
+
+		/* The pool the parallel algorithms use by default, with a worker
+		 * for every online processor but one. It is never destroyed.
+		 */
+		static thread_pool &global(void)
+		{
+			static pthread_once_t once = PTHREAD_ONCE_INIT;
+
+			pthread_once(&once, _make_global);
+			return *_global();
+		}
+
+		/* Number of threads that run tasks: the workers and the caller. */
+		size_t concurrency(void) const { return _threads + 1; }
+
+		/* Queues t on the queue of the calling thread. */
+		void spawn(pool_task const &t)
+		{
+			task_queue &q = _queues[_self()];
+
+			pthread_mutex_lock(&q.lock);
+			q.tasks.push_back(t);
+			pthread_mutex_unlock(&q.lock);
+			__atomic_add_fetch(&_queued, 1, __ATOMIC_SEQ_CST);
+			if (__atomic_load_n(&_sleeping, __ATOMIC_SEQ_CST)) {
+				pthread_mutex_lock(&_lock);
+				pthread_cond_signal(&_wake);
+				pthread_mutex_unlock(&_lock);
+			}
+		}
+
+		/* Runs tasks until pending, which the tasks count down, is 0. */
+		void wait(size_t const &pending)
+		{
+			while (__atomic_load_n(&pending, __ATOMIC_ACQUIRE)) {
+				if (!_run_one(_self()))
+					sched_yield();
+			}
+		}
+
+		/* Counts a task of a job done, for wait. */
+		static void done(size_t &pending) { __atomic_sub_fetch(&pending, 1, __ATOMIC_RELEASE); }
+
+	private:
+		/* Index of the queue of the calling thread. */
+		size_t _self(void) const
+		{
+			worker const *w = _current();
+
+			return w && w->pool == this ? w->index : _threads;
+		}
+
+		/* Runs a task from queue self, or one stolen from another queue.
+		 * Returns false if there was none.
+		 */
+		bool _run_one(size_t self)
+		{
+			pool_task t = pool_task();
+
+			if (!_pop(_queues[self], t)) {
+				size_t n = _threads + 1;
+				size_t i = 1;
+
+				for (; i < n; ++i) {
+					if (_steal(_queues[(self + i) % n], t))
+						break ;
+				}
+				if (i == n)
+					return false;
+			}
+			__atomic_sub_fetch(&_queued, 1, __ATOMIC_SEQ_CST);
+			t.run(t.job, t.first, t.last);
+			return true;
+		}
+
+		static bool _pop(task_queue &q, pool_task &t)
+		{
+			bool found;
+
+			pthread_mutex_lock(&q.lock);
+			found = q.tasks.size() > q.head;
+			if (found) {
+				t = q.tasks.back();
+				q.tasks.pop_back();
+				_compact(q);
+			}
+			pthread_mutex_unlock(&q.lock);
+			return found;
+		}
+
+		static bool _steal(task_queue &q, pool_task &t)
+		{
+			bool found;
+
+			if (pthread_mutex_trylock(&q.lock))
+				return false;
+			found = q.tasks.size() > q.head;
+			if (found) {
+				t = q.tasks[q.head++];
+				_compact(q);
+			}
+			pthread_mutex_unlock(&q.lock);
+			return found;
+		}
+
+		static void _compact(task_queue &q)
+		{
+			if (q.head == q.tasks.size()) {
+				q.tasks.clear();
+				q.head = 0;
+			}
+		}
+
+		static void *_main(void *p)
+		{
+			worker		*w = static_cast<worker *>(p);
+			thread_pool	*pool = w->pool;
+
+			_current() = w;
+			for (;;) {
+				if (pool->_run_one(w->index))
+					continue ;
+				pthread_mutex_lock(&pool->_lock);
+				__atomic_add_fetch(&pool->_sleeping, 1, __ATOMIC_SEQ_CST);
+				while (!pool->_stop && !__atomic_load_n(&pool->_queued, __ATOMIC_SEQ_CST))
+					pthread_cond_wait(&pool->_wake, &pool->_lock);
+				__atomic_sub_fetch(&pool->_sleeping, 1, __ATOMIC_SEQ_CST);
+				if (pool->_stop) {
+					pthread_mutex_unlock(&pool->_lock);
+					return 0;
+				}
+				pthread_mutex_unlock(&pool->_lock);
+			}
+		}
+
+		/* the worker the calling thread is, if any */
+		static worker *&_current(void)
+		{
+			static __thread worker *w = 0;
+
+			return w;
+		}
+
+		static thread_pool *&_global(void)
+		{
+			static thread_pool *pool = 0;
+
+			return pool;
+		}
+
+		static void _make_global(void)
+		{
+			long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+			_global() = new thread_pool(n > 1 ? n - 1 : 0);
+		}
+};
+
+} /* namespace: ft */
+
+#endif /* __THREAD_POOL_HPP__ */
@@ -0,0 +1,98 @@
+/* trace.hpp
+ * By: pducos <pducos@student.42.fr>
+ * Created: 19.10.2026
+ */
+
+#ifndef __TRACE_HPP__
+# define __TRACE_HPP__
+
+# include <ostream>
+# include <stddef.h>
+
+namespace ft
+{
+
+/* Numbers of the events counted by operation_trace. */
+struct trace_counts
+{
+	size_t	copies;			/* elements copy constructed */
+	size_t	destructions;	/* elements destroyed */
+	size_t	comparisons;	/* calls to the comparator */
+	size_t	allocations;	/* buffers or nodes allocated */
+};
+
+/* The counts of the events between two readings, such as the events of
+ * one operation: after - before.
+ */
+inline trace_counts operator-(trace_counts const &after, trace_counts const &before)
+{
+	trace_counts d;
+
+	d.copies = after.copies - before.copies;
+	d.destructions = after.destructions - before.destructions;
+	d.comparisons = after.comparisons - before.comparisons;
+	d.allocations = after.allocations - before.allocations;
+	return d;
+}
+
+inline std::ostream &operator<<(std::ostream &os, trace_counts const &c)
+{
+	return os << c.copies << " copies, "
+		<< c.destructions << " destructions, "
+		<< c.comparisons << " comparisons, "
+		<< c.allocations << " allocations";
+}
+
+/*------------------------------------------------------------*/
+/*--- Trace policies                                       ---*/
+/*------------------------------------------------------------*/
+
+/* A trace policy is told of every element copy, element destruction,
+ * comparator call and allocation of the container that holds it, which
+ * keeps one per instance. Every hook of no_trace is empty and it takes
+ * no room, so a container using it pays nothing.
+ */
+struct no_trace
+{
+	void copy(void) { }
+	void destroy(void) { }
+	void compare(void) { }
+	void allocate(void) { }
+};
+
+/* Counts the events of its container in counts, and those of every
+ * container in global(). A copy of a container starts from zero, and
+ * the counts stay with the container on swap.
+ */
+struct operation_trace
+{
+	trace_counts counts;
+
+	operation_trace(void) : counts() { }
+	operation_trace(operation_trace const &) : counts() { }
+	operation_trace &operator=(operation_trace const &) { return *this; }
+
+	void copy(void)		{ ++counts.copies; _add(&global().copies); }
+	void destroy(void)	{ ++counts.destructions; _add(&global().destructions); }
+	void compare(void)	{ ++counts.comparisons; _add(&global().comparisons); }
+	void allocate(void)	{ ++counts.allocations; _add(&global().allocations); }
+
+	void reset(void) { counts = trace_counts(); }
+
+	/* The events of all the containers using operation_trace, from every
+	 * thread. Read them when no other thread is counting.
+	 */
+	static trace_counts &global(void)
+	{
+		static trace_counts counts;
+
+		return counts;
+	}
+
+	private:
+		static void _add(size_t *n) { __atomic_add_fetch(n, 1, __ATOMIC_RELAXED); }
+};
+
+} /* namespace: ft */
+
+#endif /* __TRACE_HPP__ */
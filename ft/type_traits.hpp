@@ -7,6 +7,7 @@
 # define __TYPE_TRAITS_HPP__
 
 # include <stdint.h>
+# include <stddef.h>
 # include <vector>
 namespace ft
 {
@@ -29,26 +30,124 @@ struct enable_if { };
 template<class T>
 struct enable_if<true, T> { typedef T type; };
 
+/* Provides the type T without its topmost const qualifier. */
+template <class T> struct remove_const            { typedef T type; };
+template <class T> struct remove_const <T const>  { typedef T type; };
+
 /* Instantiation of integral_constant to represent the bool value true. */
 typedef integral_constant<bool, true>  true_type;
 /* Instantiation of integral_constant to represent the bool value false. */
 typedef integral_constant<bool, false> false_type;
 
-/* Checks whether T is an integral type. */
+/* Checks whether T is an integral type. The specializations name the
+ * fundamental types only: the fixed width types of <stdint.h>, such as
+ * int64_t, are typedefs of them, and naming both would define the same
+ * specialization twice on platforms where they coincide. */
 template <class T> struct is_integral                   : public false_type { };
+template <class T> struct is_integral <T const>         : public is_integral<T> { };
+template <class T> struct is_integral <T volatile>      : public is_integral<T> { };
+template <class T> struct is_integral <T const volatile> : public is_integral<T> { };
 template <> struct is_integral <                  bool> : public  true_type { };
-template <> struct is_integral <               int16_t> : public  true_type { };
-template <> struct is_integral <               int32_t> : public  true_type { };
-template <> struct is_integral <               wchar_t> : public  true_type { };
+template <> struct is_integral <                  char> : public  true_type { };
 template <> struct is_integral <           signed char> : public  true_type { };
-template <> struct is_integral <              long int> : public  true_type { };
-template <> struct is_integral <         long long int> : public  true_type { };
 template <> struct is_integral <         unsigned char> : public  true_type { };
+template <> struct is_integral <               wchar_t> : public  true_type { };
+template <> struct is_integral <             short int> : public  true_type { };
 template <> struct is_integral <    unsigned short int> : public  true_type { };
+template <> struct is_integral <                   int> : public  true_type { };
 template <> struct is_integral <          unsigned int> : public  true_type { };
+template <> struct is_integral <              long int> : public  true_type { };
 template <> struct is_integral <     unsigned long int> : public  true_type { };
+template <> struct is_integral <         long long int> : public  true_type { };
 template <> struct is_integral <unsigned long long int> : public  true_type { };
 
+/* Checks whether T and U are the same type. */
+template <class T, class U> struct is_same          : public false_type { };
+template <class T>          struct is_same <T, T>   : public  true_type { };
+
+/* Provides T if B is true, F otherwise. */
+template <bool B, class T, class F> struct conditional             { typedef T type; };
+template <class T, class F>         struct conditional<false, T, F> { typedef F type; };
+
+/* Checks whether T can be copied with memcpy. This needs the compiler
+ * builtin, C++98 has no way to tell. */
+template <class T>
+struct is_trivially_copyable : public integral_constant<bool, __is_trivially_copyable(T)> { };
+
+/* Checks whether an object of type T can be moved to another address by
+ * copying its bytes and forgetting the original. This holds for every
+ * trivially copyable type; specialize it for classes that hold no pointer
+ * into themselves, so that containers can move them with memcpy. */
+template <class T>
+struct is_trivially_relocatable : public is_trivially_copyable<T> { };
+
+/* Checks whether T is a class with no non-static data members, so that
+ * it takes no room as a base class. This needs the compiler builtin. */
+template <class T>
+struct is_empty : public integral_constant<bool, __is_empty(T)> { };
+
+/* Alignment requirement of T. */
+template <class T>
+struct alignment_of : public integral_constant<size_t, __alignof__(T)> { };
+
+/* Uninitialized storage of Len bytes aligned to Align, suitable to
+ * hold objects that are constructed later with placement new. */
+template <size_t Len, size_t Align>
+struct aligned_storage
+{
+	struct type
+	{
+		unsigned char data[Len] __attribute__((aligned(Align)));
+	};
+};
+
+/* Checks whether the comparator Compare declares a member type named
+ * is_transparent, which lets ordered containers search for a key of type
+ * K without converting it to their key type. K is only there to make the
+ * check depend on the key of the lookup, so that it can disable an
+ * overload instead of failing. */
+template <class Compare, class K>
+struct is_transparent
+{
+	private:
+		typedef char	yes;
+		typedef struct { char c[2]; }	no;
+
+		template <class U> static yes	test(typename U::is_transparent *);
+		template <class U> static no	test(...);
+
+	public:
+		static bool const value = sizeof(test<Compare>(0)) == sizeof(yes);
+};
+
+/* Checks whether the allocator Alloc has a member
+ *     pointer try_expand(pointer p, size_type n, size_type new_n)
+ * that grows the block p of n objects to new_n objects without copying
+ * them one by one, as ft::page_allocator does with mremap. */
+template <class Alloc>
+struct has_try_expand
+{
+	private:
+		typedef char	yes;
+		typedef struct { char c[2]; }	no;
+
+		typedef typename Alloc::pointer		pointer;
+		typedef typename Alloc::size_type	size_type;
+
+		template <pointer (Alloc::*)(pointer, size_type, size_type)> struct check { };
+
+		template <class U> static yes	test(check<&U::try_expand> *);
+		template <class U> static no	test(...);
+
+	public:
+		static bool const value = sizeof(test<Alloc>(0)) == sizeof(yes);
+};
+
+/* Compile time assertion: static_assertion<false> is never defined, so
+ * sizeof(static_assertion<Cond>) does not compile when Cond is false. */
+template <bool Cond> struct static_assertion;
+template <> struct static_assertion<true> { };
+
 } /* namespace: ft */
 
 #endif /* __TYPE_TRAITS_HPP__ */
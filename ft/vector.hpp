@@ -12,8 +12,12 @@
 # include "reverse_iterator.hpp"
 # include "equal.hpp"
 # include "type_traits.hpp"
+# include "vector_iterator.hpp"
+# include "compressed_pair.hpp"
+# include "trace.hpp"
 # include <memory>
 # include <limits>
+# include <string.h>
 # include <assert.h>
 
 # include <iostream>
@@ -21,7 +25,10 @@
 namespace ft
 {
 
-template <typename T, typename Allocator = std::allocator<T> >
+/* Trace is no_trace by default. With operation_trace the vector counts
+ * the element copies, destructions and buffer allocations it makes.
+ */
+template <typename T, typename Allocator = std::allocator<T>, typename Trace = no_trace>
 class vector
 {
     public:
@@ -35,10 +42,10 @@ class vector
         typedef typename allocator_type::pointer			pointer;
         typedef typename allocator_type::const_reference	const_reference;
         typedef typename allocator_type::reference			reference;
-        typedef value_type const*							const_iterator;
-        typedef value_type *								iterator;
-        typedef reverse_iterator<const_iterator> 			const_reverse_iterator;
-        typedef reverse_iterator<iterator> 					reverse_iterator;
+        typedef vector_iterator<value_type const>			const_iterator;
+        typedef vector_iterator<value_type>					iterator;
+        typedef ft::reverse_iterator<const_iterator> 			const_reverse_iterator;
+        typedef ft::reverse_iterator<iterator> 					reverse_iterator;
         typedef typename iterator_traits<iterator>::difference_type	difference_type;
 	    typedef size_t 										size_type;
 	
@@ -47,10 +54,18 @@ class vector
 	/*------------------------------------------------------------*/
 
 	private:
-		Allocator 	_allocator;
     	pointer 	_begin;
     	pointer 	_end;
-    	size_type	_capacity;	
+		typedef compressed_pair<Trace, size_type>	trace_pair;
+
+		/* the allocator and the trace take no room when they are stateless */
+		compressed_pair<allocator_type, trace_pair>	_impl;
+
+		allocator_type			&_allocator()			{ return _impl.first(); }
+		allocator_type const	&_allocator() const		{ return _impl.first(); }
+		Trace					&_trace()				{ return _impl.second().first(); }
+		size_type				&_capacity()			{ return _impl.second().second(); }
+		size_type const			&_capacity() const		{ return _impl.second().second(); }
 
 	/*------------------------------------------------------------*/
 	/*--- Construct/copy/destroy                               ---*/
@@ -59,17 +74,15 @@ class vector
 	public:
 		/* Constructs an empty container, with no elements. */
 		vector()
-			: _allocator()
-			, _begin(0)
+			: _begin(0)
 			, _end(0)
-			, _capacity(0)
+			, _impl(allocator_type(), trace_pair())
 		{ }
 
 		explicit vector(Allocator const &alloc)
-			: _allocator(alloc)
-			, _begin(0)
+			: _begin(0)
 			, _end(0)
-			, _capacity(0)
+			, _impl(alloc, trace_pair())
 		{ }
 
      
@@ -81,20 +94,18 @@ class vector
 			size_type n,
 			value_type const &value,
 			Allocator const &alloc = Allocator())
-			: _allocator(alloc)
-			, _begin(0)
+			: _begin(0)
 			, _end(0)
-			, _capacity(0)
+			, _impl(alloc, trace_pair())
 		{ 
 			while(n--)
 				push_back(value);
 		}
 
 		explicit vector(size_type n) 
-			: _allocator()
-			, _begin(0)
+			: _begin(0)
 			, _end(0)
-			, _capacity(0)
+			, _impl(allocator_type(), trace_pair())
     	{
 			while(n--)
 				push_back(value_type());
@@ -112,10 +123,9 @@ class vector
 			InputIterator last,
 			Allocator const &alloc = Allocator(),
 			typename ft::enable_if< !ft::is_integral<InputIterator>::value >::type* = 0)
-			: _allocator(alloc)
-			, _begin(0)
+			: _begin(0)
 			, _end(0)
-			, _capacity(0)
+			, _impl(alloc, trace_pair())
 		{
 			while (first != last)
 			{
@@ -128,15 +138,14 @@ class vector
 		 * elements in x, in the same order.
 		 */
 		vector(vector const &x)
-			: _allocator(x._allocator)
-			, _begin(0)
+			: _begin(0)
 			, _end(0)
-			, _capacity(0)
+			, _impl(x._allocator(), trace_pair())
 		{
-			value_type const *it = x.begin();
+			const_pointer it = x._begin;
 			
 			reserve(x.size());
-			while (it != x.end())
+			while (it != x._end)
 				push_back(*it++);
 		}
 
@@ -144,11 +153,11 @@ class vector
 		~vector()
 		{
 			clear();
-			if (_capacity) {
-				_allocator.deallocate(_begin, _capacity);
+			if (_capacity()) {
+				_allocator().deallocate(_begin, _capacity());
 				_begin = 0;
 				_end = 0;
-				_capacity = 0;
+				_capacity() = 0;
 			}
 		}
 
@@ -190,7 +199,13 @@ class vector
 		/* Returns a copy of the allocator object associated with
 		 * the vector.
 		 */
-		allocator_type get_allocator() const { return _allocator; }
+		allocator_type get_allocator() const { return _allocator(); }
+
+		/* Returns the trace policy object of the vector, which holds its
+		 * counts with operation_trace.
+		 */
+		Trace		&trace()		{ return _trace(); }
+		Trace const	&trace() const	{ return _impl.second().first(); }
 
 	/*------------------------------------------------------------*/
 	/*--- Iterators                                            ---*/
@@ -199,14 +214,14 @@ class vector
 		/* Returns an iterator pointing to the first element in the
 		 * vector.
 		 */
-		iterator 		begin() 		{ return _begin; }
-		const_iterator 	begin() const 	{ return _begin; }
+		iterator 		begin() 		{ return iterator(_begin, &_begin, &_end); }
+		const_iterator 	begin() const 	{ return const_iterator(_begin, &_begin, &_end); }
 
 		/* Returns an iterator referring to the past-the-end element
 		 * in the vector container.
 		 */
-		iterator 		end()			{ return _end; }
-		const_iterator 	end() const 	{ return _end; }
+		iterator 		end()			{ return iterator(_end, &_begin, &_end); }
+		const_iterator 	end() const 	{ return const_iterator(_end, &_begin, &_end); }
 
 		/* Returns a reverse iterator pointing to the last element
 		 * in the vector (i.e., its reverse beginning).
@@ -226,7 +241,7 @@ class vector
 	/*------------------------------------------------------------*/
 	
 		size_type size() const 		{ return static_cast<size_type>(_end - _begin); }
-		size_type capacity() const 	{ return _capacity; }
+		size_type capacity() const 	{ return _capacity(); }
 
 		/* Returns the maximum number of elements that the vector can hold. */
 		size_type max_size() const { return allocator_type().max_size(); }
@@ -251,23 +266,23 @@ class vector
 		{
 			assert(n < max_size());
 
-			if (n <= _capacity)
+			if (n <= _capacity())
 				return ;
 
 			size_type 	len = size();
-			pointer  	ptr = _allocator.allocate(n);
-			
-			if (_capacity)
+			pointer  	ptr = _capacity() ? _expand(n, can_expand()) : 0;
+
+			if (!ptr)
 			{
-				size_type i = _capacity;
-				while (i--)
+				ptr = _allocator().allocate(n);
+				if (_capacity())
 				{
-					_allocator.construct(ptr + i, *(_begin + i));		
-					_allocator.destroy(ptr + i);
-				} 	
-				_allocator.deallocate(_begin, _capacity);
+					_relocate(ptr, is_trivially_relocatable<value_type>());
+					_allocator().deallocate(_begin, _capacity());
+				}
 			}
-			_capacity = n;
+			_trace().allocate();
+			_capacity() = n;
 			_begin = ptr;
 			_end = ptr + len;
 		}
@@ -302,6 +317,10 @@ class vector
 		reference 		back()			{ assert(!empty()); return *(_end - 1); }
 		const_reference back() const 	{ assert(!empty()); return *(_end - 1); }
 
+		/* Returns a pointer to the underlying storage. */
+		pointer 		data()			{ return _begin; }
+		const_pointer 	data() const 	{ return _begin; }
+
 	/*------------------------------------------------------------*/
 	/*--- Modifiers                                            ---*/
 	/*------------------------------------------------------------*/
@@ -312,15 +331,14 @@ class vector
 		 */
 		void push_back(value_type const &x)
 		{
-			if (size() == _capacity)
-				reserve(size() + 1);
-			_allocator.construct(_end++, x);
+			_grow(size() + 1);
+			_construct(_end++, x);
 		}
 
 		/* Removes the last element in the vector, effectively reducing
 		 * the container size by one.
 		 */
-		void pop_back() { assert(!empty()); _allocator.destroy(--_end); }
+		void pop_back() { assert(!empty()); _destroy(--_end); }
 
 		/* The vector is extended by inserting new elements before the
 		 * element at the specified position, effectively increasing
@@ -329,23 +347,23 @@ class vector
 		iterator insert(iterator position, value_type const &x)
 		{
 			/* check if 'position' is in this vector */
-			assert(position <= _end
-				&& position >= _begin);
+			assert(position.base() <= _end
+				&& position.base() >= _begin);
 
-			size_type offset = position - _begin;
-			reserve(size() + 1);
+			size_type offset = position.base() - _begin;
+			_grow(size() + 1);
 			
-			iterator end_ptr 	= _end;
-			iterator start_ptr 	= _begin + offset;
+			pointer end_ptr 	= _end;
+			pointer start_ptr 	= _begin + offset;
 			
 			while (end_ptr != start_ptr) {
 				--end_ptr;
-				_allocator.construct(end_ptr + 1, *end_ptr);
-				_allocator.destroy(end_ptr);
+				_construct(end_ptr + 1, *end_ptr);
+				_destroy(end_ptr);
 			}
-			_allocator.construct(end_ptr, x);
+			_construct(end_ptr, x);
 			_end++;
-			return (end_ptr);
+			return iterator(end_ptr, &_begin, &_end);
 		}
 
 		void insert(
@@ -354,23 +372,23 @@ class vector
 			value_type const &x)
 		{
 			/* check if 'position' is in this vector */
-			assert(position <= _end
-				&& position >= _begin);
+			assert(position.base() <= _end
+				&& position.base() >= _begin);
 			
-			size_type offset = position - _begin;
-			reserve(size() + n);
+			size_type offset = position.base() - _begin;
+			_grow(size() + n);
 			
-			iterator end_ptr 	= _end;
-			iterator start_ptr 	= _begin + offset;
+			pointer end_ptr 	= _end;
+			pointer start_ptr 	= _begin + offset;
 			
 			while (end_ptr != start_ptr) {
 				end_ptr--;
-				_allocator.construct(end_ptr + n, *end_ptr);	
-				_allocator.destroy(end_ptr);	
+				_construct(end_ptr + n, *end_ptr);	
+				_destroy(end_ptr);	
 			}
 			while (n--)
 			{
-				_allocator.construct(end_ptr, x);
+				_construct(end_ptr, x);
 				end_ptr++;
 				_end++;
 			}
@@ -384,33 +402,29 @@ class vector
 			typename ft::enable_if< !ft::is_integral<InputIterator>::value >::type* = 0)
 		{
 			/* check if 'position' is in this vector */
-			assert(position <= _end
-				&& position >= _begin);
+			assert(position.base() <= _end
+				&& position.base() >= _begin);
 
-			size_type offset 		= position - _begin;
+			size_type offset 		= position.base() - _begin;
 			difference_type dist 	= std::distance(first, last);
-			reserve(size() + dist);
+			_grow(size() + dist);
 			
-			iterator end_ptr 	= _end;
-			iterator start_ptr 	= _begin + offset;
+			pointer end_ptr 	= _end;
+			pointer start_ptr 	= _begin + offset;
 			
 			while (end_ptr != start_ptr) {
 				end_ptr--;
-				_allocator.construct(end_ptr + dist, *end_ptr);
-				_allocator.destroy(end_ptr);
+				_construct(end_ptr + dist, *end_ptr);
+				_destroy(end_ptr);
 			}
             while (dist--) {
-             	 _allocator.construct(start_ptr++, *first++);
+             	 _construct(start_ptr++, *first++);
 				++_end;
 			}
-			return (end_ptr);
+			return iterator(end_ptr, &_begin, &_end);
 		}
 
-		iterator erase(iterator position)
-		{
-			erase(position, position + 1);
-			return(position);
-		}
+		iterator erase(iterator position) { return erase(position, position + 1); }
 
 		/* Removes from the vector either a single element
 		 * (position) or a range of elements ([first,last)).
@@ -421,52 +435,109 @@ class vector
 		{
 			/* check if 'first' to 'last' is in this vector */
 			assert(
-				first <= _end
-				&& first >= _begin
-				&& last <= _end
-				&& last >= _begin);
-
-			pointer ptr = first;
-			while (last != end()) {
-				_allocator.destroy(ptr);
-				_allocator.construct(ptr, *last);
+				first.base() <= _end
+				&& first.base() >= _begin
+				&& last.base() <= _end
+				&& last.base() >= _begin);
+
+			pointer ptr = first.base();
+			pointer src = last.base();
+			if (ptr == src)
+				return first;
+			while (src != _end) {
+				_destroy(ptr);
+				_construct(ptr, *src);
 				ptr++;
-				last++;
+				src++;
 			}
 			while (ptr != _end)
 				pop_back();
-			return first;
+			return iterator(first.base(), &_begin, &_end);
 		}
 
 		/* Exchanges the content of the container by the content
 		 * of x, which is another vector object of the same type.
 		 * Sizes may differ.
 		 */
-		void swap(vector<value_type, Allocator> &x)
+		void swap(vector &x)
 		{
-			assert(_allocator == x._allocator);
+			assert(_allocator() == x._allocator());
 
-    	    std::swap(_allocator, x._allocator);
+    	    std::swap(_allocator(), x._allocator());
     	    std::swap(_begin,     x._begin);
     	    std::swap(_end,       x._end);
-    	    std::swap(_capacity,  x._capacity);
+    	    std::swap(_capacity(),  x._capacity());
     	}
 
 		/* Removes all elements from the vector (which are destroyed),
 		 * leaving the container with a size of 0.
 		 */
 		void clear() { while(!empty()) pop_back(); }
-	
+
+	private:
+		void _construct(pointer p, value_type const &x)
+		{
+			_allocator().construct(p, x);
+			_trace().copy();
+		}
+
+		void _destroy(pointer p)
+		{
+			_allocator().destroy(p);
+			_trace().destroy();
+		}
+
+		/* Whether the storage can grow through the try_expand member of
+		 * the allocator, which may move its bytes to another address.
+		 */
+		typedef integral_constant<bool,
+			is_trivially_relocatable<value_type>::value
+			&& has_try_expand<allocator_type>::value>		can_expand;
+
+		/* Tries to grow the storage to n elements without copying them.
+		 * Returns the new storage, or 0 if it has to be copied.
+		 */
+		pointer _expand(size_type n, true_type)
+		{
+			return _allocator().try_expand(_begin, _capacity(), n);
+		}
+
+		pointer _expand(size_type, false_type) { return 0; }
+
+		/* Moves the elements to the storage at ptr. */
+		void _relocate(pointer ptr, true_type)
+		{
+			memcpy(static_cast<void *>(ptr), static_cast<void *>(_begin), size() * sizeof(value_type));
+		}
+
+		void _relocate(pointer ptr, false_type)
+		{
+			size_type i = size();
+			while (i--)
+			{
+				_construct(ptr + i, *(_begin + i));
+				_destroy(_begin + i);
+			}
+		}
+
+		/* Makes room for n elements. The capacity at least doubles, so a
+		 * sequence of push_back runs in amortized constant time.
+		 */
+		void _grow(size_type n)
+		{
+			if (n > _capacity())
+				reserve(n > _capacity() * 2 ? n : _capacity() * 2);
+		}
 };
 
 /*------------------------------------------------------------*/
 /*--- Non member functions                                 ---*/
 /*------------------------------------------------------------*/
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Trace>
 inline bool operator==(
-	const vector<T, Allocator> &x,
-	const vector<T, Allocator> &y)
+	const vector<T, Allocator, Trace> &x,
+	const vector<T, Allocator, Trace> &y)
 {
 	return (x.size() == y.size()
 		&& ft::equal(
@@ -475,15 +546,15 @@ inline bool operator==(
 			y.begin()));
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Trace>
 inline bool operator!=(
-	vector<T, Allocator> const &x,
-	vector<T, Allocator> const &y) { return !(x == y); }
+	vector<T, Allocator, Trace> const &x,
+	vector<T, Allocator, Trace> const &y) { return !(x == y); }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Trace>
 inline bool operator<(
-	vector<T, Allocator> const &x,
-	vector<T, Allocator> const &y)
+	vector<T, Allocator, Trace> const &x,
+	vector<T, Allocator, Trace> const &y)
 {
 	return ft::lexicographical_compare(
 		x.begin(),
@@ -493,25 +564,29 @@ inline bool operator<(
 	);
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Trace>
 inline bool operator>(
-	vector<T, Allocator> const &x,
-	vector<T, Allocator> const &y) { return (y < x); }
+	vector<T, Allocator, Trace> const &x,
+	vector<T, Allocator, Trace> const &y) { return (y < x); }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Trace>
 inline bool operator>=(
-	vector<T, Allocator> const &x,
-	vector<T, Allocator> const &y) { return !(x < y); }
+	vector<T, Allocator, Trace> const &x,
+	vector<T, Allocator, Trace> const &y) { return !(x < y); }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Trace>
 inline bool operator<=(
-	vector<T, Allocator> const &x,
-	vector<T, Allocator> const &y) { return !(y < x); }
+	vector<T, Allocator, Trace> const &x,
+	vector<T, Allocator, Trace> const &y) { return !(y < x); }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Trace>
 void swap(
-	vector<T, Allocator> &x,
-	vector<T, Allocator> &y) { x.swap(y); }
+	vector<T, Allocator, Trace> &x,
+	vector<T, Allocator, Trace> &y) { x.swap(y); }
+
+/* A vector with a stateless allocator is three pointers. */
+typedef char vector_size_check[
+	sizeof(static_assertion<sizeof(vector<int>) == 3 * sizeof(int *)>)];
 
 } /* ft */
 
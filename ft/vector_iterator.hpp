@@ -6,5 +6,147 @@
 #ifndef __VECTOR_ITERATOR_HPP__
 # define __VECTOR_ITERATOR_HPP__
 
+# include <iterator>
+# include <stddef.h>
+# include <assert.h>
+# include "type_traits.hpp"
+
+namespace ft
+{
+
+/* Random access iterator over contiguous storage, T is const qualified
+ * for const iterators.
+ *
+ * By default it is a plain pointer wrapped in a class: it is trivially
+ * copyable, has the size of a pointer and compiles to the same code as a
+ * pointer loop. Defining FT_DEBUG_ITERATORS makes every iterator also
+ * point to the begin and end pointers of its container, and assert when
+ * it is dereferenced that it is within the storage the container has at
+ * that time: an iterator kept across a reallocation, or past an erased
+ * end, is caught there.
+ */
+template <typename T>
+class vector_iterator
+{
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member types                                         ---*/
+	/*------------------------------------------------------------*/
+
+		typedef std::random_access_iterator_tag				iterator_category;
+		typedef typename ft::remove_const<T>::type			value_type;
+		typedef T *											pointer;
+		typedef T &											reference;
+		typedef std::ptrdiff_t								difference_type;
+
+	private:
+		pointer		_current;
+# ifdef FT_DEBUG_ITERATORS
+		pointer const	*_first;
+		pointer const	*_last;
+# endif
+
+	public:
+	/*------------------------------------------------------------*/
+	/*--- Member functions                                     ---*/
+	/*------------------------------------------------------------*/
+
+# ifdef FT_DEBUG_ITERATORS
+		vector_iterator(void) : _current(0), _first(0), _last(0) { }
+
+		/* p points into the storage [*first, *last) of a container. */
+		vector_iterator(pointer p, pointer const *first, pointer const *last)
+			: _current(p)
+			, _first(first)
+			, _last(last)
+		{ }
+
+		/* Converts an iterator to a const iterator. */
+		template <typename U>
+		vector_iterator(vector_iterator<U> const &other)
+			: _current(other.base())
+			, _first(other.first())
+			, _last(other.last())
+		{ }
+
+		pointer const	*first(void) const	{ return _first; }
+		pointer const	*last(void) const	{ return _last; }
+# else
+		vector_iterator(void) : _current(0) { }
+
+		vector_iterator(pointer p, pointer const *, pointer const *) : _current(p) { }
+
+		/* Converts an iterator to a const iterator. */
+		template <typename U>
+		vector_iterator(vector_iterator<U> const &other) : _current(other.base()) { }
+# endif
+
+		/* Returns the underlying pointer. */
+		pointer base(void) const { return _current; }
+
+		reference	operator*() const						{ _check(1); return *_current; }
+		pointer		operator->() const						{ _check(1); return _current; }
+		reference	operator[](difference_type n) const	{ return *(*this + n); }
+
+		vector_iterator	&operator++()						{ ++_current; return *this; }
+		vector_iterator	&operator--()						{ --_current; return *this; }
+		vector_iterator	operator++(int)						{ vector_iterator tmp(*this); ++*this; return tmp; }
+		vector_iterator	operator--(int)						{ vector_iterator tmp(*this); --*this; return tmp; }
+		vector_iterator	&operator+=(difference_type n)		{ _current += n; return *this; }
+		vector_iterator	&operator-=(difference_type n)		{ _current -= n; return *this; }
+		vector_iterator	operator+(difference_type n) const	{ vector_iterator tmp(*this); return tmp += n; }
+		vector_iterator	operator-(difference_type n) const	{ vector_iterator tmp(*this); return tmp -= n; }
+
+	private:
+		/* Asserts that _current + n stays within [*first, *last]. */
+# ifdef FT_DEBUG_ITERATORS
+		void _check(difference_type n) const
+		{ assert(_current >= *_first && _current + n <= *_last); }
+# else
+		void _check(difference_type) const { }
+# endif
+};
+
+/*------------------------------------------------------------*/
+/*--- Non member functions                                 ---*/
+/*------------------------------------------------------------*/
+
+template <typename T1, typename T2>
+bool operator==(vector_iterator<T1> const &lhs, vector_iterator<T2> const &rhs)
+{ return lhs.base() == rhs.base(); }
+
+template <typename T1, typename T2>
+bool operator!=(vector_iterator<T1> const &lhs, vector_iterator<T2> const &rhs)
+{ return lhs.base() != rhs.base(); }
+
+template <typename T1, typename T2>
+bool operator<(vector_iterator<T1> const &lhs, vector_iterator<T2> const &rhs)
+{ return lhs.base() < rhs.base(); }
+
+template <typename T1, typename T2>
+bool operator<=(vector_iterator<T1> const &lhs, vector_iterator<T2> const &rhs)
+{ return lhs.base() <= rhs.base(); }
+
+template <typename T1, typename T2>
+bool operator>(vector_iterator<T1> const &lhs, vector_iterator<T2> const &rhs)
+{ return lhs.base() > rhs.base(); }
+
+template <typename T1, typename T2>
+bool operator>=(vector_iterator<T1> const &lhs, vector_iterator<T2> const &rhs)
+{ return lhs.base() >= rhs.base(); }
+
+template <typename T1, typename T2>
+typename vector_iterator<T1>::difference_type operator-(
+	vector_iterator<T1> const &lhs,
+	vector_iterator<T2> const &rhs)
+{ return lhs.base() - rhs.base(); }
+
+template <typename T>
+vector_iterator<T> operator+(
+	typename vector_iterator<T>::difference_type n,
+	vector_iterator<T> const &it)
+{ return it + n; }
+
+} /* namespace: ft */
 
 #endif /* __VECTOR_ITERATOR_HPP__ */
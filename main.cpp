@@ -1,9 +1,35 @@
 #include "ft/vector.hpp"
+#include "ft/persistent_map.hpp"
+#include "ft/map.hpp"
+#include "ft/static_vector.hpp"
+#include "ft/incremental_vector.hpp"
+#include "ft/bounded_queue.hpp"
+#include "ft/priority_queue.hpp"
+#include "ft/eytzinger_set.hpp"
+#include "ft/caching_allocator.hpp"
+#include "ft/page_allocator.hpp"
+#include "ft/soa_vector.hpp"
+#include "ft/concurrent_map.hpp"
+#include "ft/parallel.hpp"
+#include "ft/trace.hpp"
+#include "ft/radix_map.hpp"
+#include "ft/intrusive_map.hpp"
+#include "ft/perfect_hash_map.hpp"
+#include <algorithm>
 #include <limits>
 #include <vector>
 #include <list>
+#include <map>
+#include <memory>
+#include <iterator>
+#include <sstream>
 #include <iostream>
+#include <string>
 #include <assert.h>
+#include <stdio.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/wait.h>
 
 void test_01(void)
 {
@@ -131,9 +157,1290 @@ void test_04(void)
 	std::cout << *--it << std::endl;
 }
 
+void test_05(void)
+{
+	ft::persistent_map<int, int> map;
+
+	for (int i = 0; i < 100; ++i)
+		map.insert(ft::make_pair(i, i * 2));
+
+	ft::persistent_map<int, int> snap = map.snapshot();
+
+	for (int i = 0; i < 100; i += 2)
+		map.erase(i);
+	map.assign(ft::make_pair(1, 42));
+	map.insert(ft::make_pair(1000, 0));
+
+	assert(map.size() == 51);
+	assert(snap.size() == 100);
+	assert(map.at(1) == 42);
+	assert(snap.at(1) == 2);
+	assert(map.count(2) == 0);
+	assert(snap.count(2) == 1);
+	assert(map.lower_bound(2)->first == 3);
+	assert(map.upper_bound(999)->first == 1000);
+	assert(map.find(4) == map.end());
+
+	int expected = 0;
+	for (ft::persistent_map<int, int>::iterator it = snap.begin(); it != snap.end(); ++it)
+		assert(it->first == expected++);
+	assert(expected == 100);
+	assert((--map.end())->first == 1000);
+	assert(map.rbegin()->first == 1000);
+	std::cout << "OK" << std::endl;
+}
+
+/* Whether a From converts implicitly to a To. */
+template <class From, class To>
+struct converts
+{
+	static char	test(To);
+	static long	test(...);
+	static From	make(void);
+
+	enum { value = sizeof(test(make())) == 1 };
+};
+
+void test_06(void)
+{
+	typedef ft::map<
+		int,
+		int,
+		ft::less<int>,
+		std::allocator<ft::pair<const int, int> >,
+		ft::order_statistics
+	> ranked_map;
+
+	ranked_map map;
+
+	for (int i = 0; i < 100; ++i)
+		map[i * 10] = i;
+	for (int i = 0; i < 100; i += 3)
+		map.erase(i * 10);
+
+	assert(map.size() == 66);
+	assert(map.nth(0)->first == 10);
+	assert(map.nth(1)->first == 20);
+	assert(map.nth(65)->first == 980);
+	assert(map.nth(66) == map.end());
+	assert(map.rank(10) == 0);
+	assert(map.rank(25) == 2);
+	assert(map.rank(1000) == 66);
+	assert(map.index_of(map.find(40)) == 2);
+	assert(map.distance(map.begin(), map.end()) == 66);
+	assert(map.distance(map.find(20), map.find(50)) == 2);
+	assert((converts<ranked_map::iterator, ranked_map::const_iterator>::value));
+	assert(!(converts<ranked_map::const_iterator, ranked_map::iterator>::value));
+	std::cout << "OK" << std::endl;
+}
+
+void test_07(void)
+{
+	ft::map<int, int> map;
+	ft::vector<int> keys;
+
+	for (int i = 0; i < 1000; i += 2)
+		map[i] = i;
+	for (int i = 999; i >= -1; i -= 7)
+		keys.push_back(i);
+
+	std::vector<ft::map<int, int>::iterator> found;
+	std::vector<ft::map<int, int>::const_iterator> bounds;
+	ft::map<int, int> const &cmap = map;
+
+	map.find_batch(keys.begin(), keys.end(), std::back_inserter(found));
+	cmap.lower_bound_batch(keys.begin(), keys.end(), std::back_inserter(bounds));
+	assert(found.size() == keys.size());
+	assert(bounds.size() == keys.size());
+	for (size_t i = 0; i < keys.size(); ++i) {
+		assert(found[i] == map.find(keys[i]));
+		assert(bounds[i] == map.lower_bound(keys[i]));
+	}
+	std::cout << "OK" << std::endl;
+}
+
+void test_08(void)
+{
+	ft::map<int, char> x;
+	ft::map<int, char> y;
+
+	for (int i = 0; i < 10; ++i)
+		x[i] = 'x';
+	for (int i = 5; i < 15; ++i)
+		y[i] = 'y';
+
+	ft::map<int, char> u = ft::set_union(x, y);
+	ft::map<int, char> i = ft::set_intersection(x, y);
+	ft::map<int, char> d = ft::set_difference(x, y);
+
+	assert(u.size() == 15 && u[5] == 'x' && u[14] == 'y');
+	assert(i.size() == 5 && i.begin()->first == 5 && i[9] == 'x');
+	assert(d.size() == 5 && d.rbegin()->first == 4);
+
+	x.merge(y);
+	assert(x.size() == 15 && x[12] == 'y');
+	assert(y.size() == 5 && y.begin()->first == 5 && y.rbegin()->first == 9);
+	std::cout << "OK" << std::endl;
+}
+
+void test_09(void)
+{
+	ft::map<int, std::string> hot;
+	ft::map<int, std::string> cold;
+
+	hot[1] = "one";
+	hot[2] = "two";
+	cold[2] = "deux";
+
+	std::string const *one = &hot[1];
+	ft::map<int, std::string>::insert_return_type ret = cold.insert(hot.extract(1));
+
+	assert(ret.inserted && ret.node.empty());
+	assert(&ret.position->second == one);
+	assert(hot.size() == 1 && cold.size() == 2);
+
+	ret = cold.insert(hot.extract(2));
+	assert(!ret.inserted && !ret.node.empty());
+	assert(ret.position->second == "deux");
+
+	ret.node.key() = 3;
+	ret = cold.insert(ret.node);
+	assert(ret.inserted && cold[3] == "two");
+	assert(hot.empty() && cold.size() == 3);
+
+	ft::map<int, std::string>::node_type nh = cold.extract(42);
+	assert(nh.empty());
+	nh = cold.extract(cold.begin());
+	assert(nh.key() == 1 && nh.mapped() == "one");
+	std::cout << "OK" << std::endl;
+}
+
+void test_10(void)
+{
+	ft::static_vector<int, 8> vct;
+	ft::static_vector<std::string, 4> str(2, "abc");
+
+	for (int i = 0; i < 6; ++i)
+		vct.push_back(i);
+	vct.erase(vct.begin() + 1, vct.begin() + 3);
+	vct.insert(vct.begin(), 2, 42);
+	assert(vct.size() == 6 && vct.full() == false);
+	assert(vct[0] == 42 && vct[1] == 42 && vct[2] == 0 && vct[3] == 3);
+	assert(*vct.rbegin() == 5);
+
+	ft::static_vector<int, 8> cpy(vct);
+	assert(cpy == vct);
+	cpy.pop_back();
+	assert(cpy < vct);
+
+	str.insert(str.begin() + 1, "x");
+	assert(str.size() == 3 && str[1] == "x" && str[2] == "abc");
+	try {
+		str.insert(str.end(), 2, "y");
+		assert(false);
+	} catch (std::length_error const &) { }
+	std::cout << "OK" << std::endl;
+}
+
+void test_11(void)
+{
+	ft::incremental_vector<int> vct;
+
+	for (int i = 0; i < 9; ++i)
+		vct.push_back(i);
+	assert(vct.capacity() == 16 && vct.migrating());
+	for (int i = 0; i < 9; ++i)
+		assert(vct[i] == i);
+
+	vct.push_back(9);
+	vct.pop_back();
+	assert(!vct.migrating());
+
+	int expected = 0;
+	for (ft::incremental_vector<int>::iterator it = vct.begin(); it != vct.end(); ++it)
+		assert(*it == expected++);
+	assert(vct.end() - vct.begin() == 9 && vct.back() == 8);
+
+	ft::incremental_vector<int> cpy(vct);
+	assert(cpy == vct);
+	std::cout << "OK" << std::endl;
+}
+
+void test_12(void)
+{
+	typedef ft::map<int, int, ft::less<int>, std::allocator<ft::pair<const int, int> >,
+		ft::order_statistics> ranked_map;
+	ranked_map			days;
+
+	for (int i = 0; i < 1000; ++i)
+		days[i] = i * 2;
+
+	ranked_map			recent = days.split(600);
+
+	assert(days.size() == 600 && recent.size() == 400);
+	assert(days.rbegin()->first == 599 && recent.begin()->first == 600);
+	assert(recent.nth(10)->first == 610 && recent.rank(700) == 100);
+	assert((--days.end())->second == 1198);
+
+	ranked_map			later;
+
+	for (int i = 2000; i < 2100; ++i)
+		later[i] = i;
+	recent.join(later);
+	assert(later.empty() && recent.size() == 500);
+	assert(recent.nth(400)->first == 2000 && recent.rbegin()->first == 2099);
+
+	days.join(recent);
+	assert(days.size() == 1100 && recent.empty());
+	assert(days.split(5000).empty() && days.split(-1).size() == 1100);
+	assert(days.empty());
+	std::cout << "OK" << std::endl;
+}
+
+void test_13(void)
+{
+	ft::spsc_queue<std::string>	spsc(3);
+	ft::mpmc_queue<int>			mpmc(5);
+	std::string					s;
+	int							batch[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	int							out[10];
+
+	assert(spsc.capacity() == 4 && mpmc.capacity() == 8);
+	for (int round = 0; round < 3; ++round) {
+		assert(spsc.push("a") && spsc.push("b") && spsc.push("c") && spsc.push("d"));
+		assert(!spsc.push("e") && spsc.size() == 4);
+		assert(spsc.pop(s) && s == "a");
+		assert(spsc.pop(s) && s == "b");
+		assert(spsc.pop(s) && spsc.pop(s) && s == "d");
+		assert(!spsc.pop(s) && spsc.empty());
+	}
+
+	assert(mpmc.push_n(batch, 10) == 8);
+	assert(!mpmc.push(10) && mpmc.size() == 8);
+	assert(mpmc.pop_n(out, 3) == 3 && out[2] == 2);
+	assert(mpmc.push_n(batch + 8, 2) == 2);
+	assert(mpmc.pop_n(out, 10) == 7 && out[0] == 3 && out[6] == 9);
+	assert(!mpmc.pop(out[0]) && mpmc.empty());
+	std::cout << "OK" << std::endl;
+}
+
+void test_14(void)
+{
+	int											values[] = { 5, 1, 9, 3, 7, 2, 8 };
+	ft::priority_queue<int, ft::vector<int>, ft::less<int>, 4>	queue(values, values + 7);
+
+	queue.push_range(values, values + 3);
+	assert(queue.size() == 10 && queue.top() == 9);
+	queue.pop();
+	assert(queue.top() == 9);
+	queue.pop();
+	assert(queue.top() == 8);
+
+	ft::indexed_priority_queue<int, ft::greater<int> >	timers;
+	size_t												a = timers.push(30);
+	size_t												b = timers.push(10);
+	size_t												c = timers.push(20);
+
+	assert(timers.top() == 10 && timers.top_handle() == b);
+	timers.decrease_key(a, 5);
+	assert(timers.top_handle() == a);
+	timers.update(a, 40);
+	timers.erase(b);
+	assert(!timers.contains(b) && timers.top_handle() == c);
+	timers.pop();
+	assert(timers.size() == 1 && timers.value(a) == 40);
+	std::cout << "OK" << std::endl;
+}
+
+static long allocated_blocks = 0;	/* live */
+static long allocations = 0;		/* ever handed out */
+
+/* std::allocator that counts the blocks it has handed out. */
+template <class T>
+struct counting_allocator : std::allocator<T>
+{
+	template <class U>
+	struct rebind { typedef counting_allocator<U> other; };
+
+	counting_allocator(void) { }
+	template <class U>
+	counting_allocator(counting_allocator<U> const &) { }
+
+	T *allocate(size_t n, void const * = 0)
+	{
+		++allocated_blocks;
+		++allocations;
+		return std::allocator<T>::allocate(n);
+	}
+
+	void deallocate(T *p, size_t n)
+	{
+		--allocated_blocks;
+		std::allocator<T>::deallocate(p, n);
+	}
+};
+
+/* Compares with a string by its first letter, and converts to nothing. */
+struct initial
+{
+	char c;
+};
+
+template <class String>
+bool operator<(initial const &a, String const &b) { return b.empty() || a.c < b[0]; }
+
+template <class String>
+bool operator<(String const &a, initial const &b) { return !a.empty() && a[0] < b.c; }
+
+void test_15(void)
+{
+	ft::map<std::string, int, ft::less<void> >	words;
+	char const									*key = "banana";
+
+	words["apple"] = 1;
+	words["banana"] = 2;
+	words["cherry"] = 3;
+
+	assert(words.find(key)->second == 2 && words.count("cherry") == 1);
+	assert(words.find("durian") == words.end());
+	assert(words.lower_bound("b")->first == "banana");
+	assert(words.upper_bound(key)->first == "cherry");
+	assert(words.equal_range("apple").first == words.begin());
+	assert(words.find(std::string("apple"))->second == 1);
+
+	/* a key is compared as it is, never converted to a key_type */
+	typedef std::basic_string<char, std::char_traits<char>, counting_allocator<char> >	counted_string;
+
+	ft::map<counted_string, int, ft::less<void> >	long_words;
+	initial const									a = { 'a' };
+	long											before;
+
+	long_words["a word too long for the small string buffer"] = 1;
+	long_words["another word too long for the small string buffer"] = 2;
+	before = allocations;
+	for (int i = 0; i < 1000; ++i)
+		assert(long_words.count("another word too long for the small string buffer") == 1);
+	assert(long_words.lower_bound("b") == long_words.end());
+	assert(long_words.equal_range(a).first == long_words.begin());
+	assert(long_words.equal_range(a).second == long_words.end());
+	assert(allocations == before);
+	std::cout << "OK" << std::endl;
+}
+
+void test_16(void)
+{
+	ft::vector<int>	sorted;
+
+	for (int i = 0; i < 100; ++i)
+		sorted.push_back(3 * i);
+
+	ft::eytzinger_set<int> set(sorted);
+
+	assert(set.size() == 100 && set.contains(42) && !set.contains(43));
+	assert(*set.lower_bound(43) == 45 && set.lower_bound(298) == 0);
+	assert(set.rank(43) == 15 && set.rank(1000) == 100);
+	assert(set.index_of(set.find(297)) == 99);
+	std::cout << "OK" << std::endl;
+}
+
+typedef ft::map<int, int, ft::less<int>, ft::caching_allocator<ft::pair<const int, int> > >	cached_map;
+
+static void *destroy_map(void *m)
+{
+	delete static_cast<cached_map *>(m);
+	return 0;
+}
+
+void test_17(void)
+{
+	cached_map	*m = new cached_map;
+	pthread_t	thread;
+
+	for (int i = 0; i < 1000; ++i)
+		(*m)[i] = i;
+
+	cached_map copy(*m);
+
+	/* the nodes are freed on another thread, then reused here */
+	pthread_create(&thread, 0, destroy_map, m);
+	pthread_join(thread, 0);
+	for (int i = 0; i < 1000; i += 2)
+		copy.erase(i);
+	for (int i = 1000; i < 3000; ++i)
+		copy[i] = i;
+	assert(copy.size() == 2500 && copy[999] == 999 && copy[2999] == 2999);
+	std::cout << "OK" << std::endl;
+}
+
+void test_18(void)
+{
+	ft::vector<long, ft::page_allocator<long> >	v;
+	ft::vector<std::string, ft::page_allocator<std::string> >	s;
+
+	assert(ft::has_try_expand<ft::page_allocator<long> >::value);
+	assert(!ft::has_try_expand<std::allocator<long> >::value);
+
+	/* grows past the mapping threshold, then with mremap */
+	for (long i = 0; i < 1000000; ++i)
+		v.push_back(i);
+	v.reserve(3000000);
+	for (long i = 0; i < 1000000; i += 999)
+		assert(v[i] == i);
+
+	for (int i = 0; i < 50000; ++i)
+		s.push_back(std::string(20, 'a' + i % 26));
+	assert(s[49999] == std::string(20, 'a' + 49999 % 26));
+	std::cout << "OK" << std::endl;
+}
+
+void test_19(void)
+{
+	ft::soa_vector<int, std::string>	v;
+	long								sum = 0;
+
+	for (int i = 0; i < 100; ++i)
+		v.push_back((i * 37) % 100, std::string(1, 'a' + i % 26));
+	std::sort(v.begin(), v.end());
+	for (int i = 0; i < 100; ++i)
+		assert(v[i].first == i);
+
+	ft::soa_span<int> keys = v.first_column();
+
+	for (ft::soa_span<int>::iterator it = keys.begin(); it != keys.end(); ++it)
+		sum += *it;
+	assert(sum == 4950 && v.second_column().size() == 100);
+
+	v.erase(v.begin(), v.begin() + 50);
+	ft::pair<int, std::string> front = v.front();
+	assert(v.size() == 50 && front.first == 50 && v.begin()->second == front.second);
+	std::cout << "OK" << std::endl;
+}
+
+void test_20(void)
+{
+	ft::map<int, std::string>	m;
+
+	for (int i = 0; i < 1000; ++i)
+		m[(i * 7919) % 1000] = std::string(10, 'a' + i % 26);
+	m.compact();
+	assert(m.fragmentation() == 0 && m.size() == 1000);
+	for (int i = 0; i < 1000; i += 3)
+		m.erase(i);
+
+	ft::map<int, std::string> high = m.split(500);
+	assert(m.size() + high.size() == 666 && (--m.end())->first == 499);
+	m.join(high);
+	m.compact();
+	assert(m.fragmentation() == 0 && m.size() == 666 && m[998].size() == 10);
+	std::cout << "OK" << std::endl;
+}
+
+typedef ft::concurrent_map<int, int>	shared_map;
+
+static void *write_map(void *m)
+{
+	shared_map *map = static_cast<shared_map *>(m);
+
+	for (int i = 0; i < 2000; ++i) {
+		map->insert_or_assign(i % 100, i);
+		if (i % 3 == 0)
+			map->erase((i + 50) % 100);
+	}
+	return 0;
+}
+
+void test_21(void)
+{
+	shared_map	m;
+	pthread_t	thread;
+
+	for (int i = 0; i < 100; i += 2)
+		m.insert(ft::make_pair(i, i));
+
+	shared_map::snapshot_type before = m.snapshot();
+
+	/* readers see whole versions while the writer runs */
+	pthread_create(&thread, 0, write_map, &m);
+	for (int n = 0; n < 200; ++n) {
+		ft::epoch_guard guard;
+		int				prev = -1;
+
+		for (shared_map::const_iterator it = m.begin(); it != m.end(); ++it) {
+			assert(it->first > prev && it->second % 100 == it->first);
+			prev = it->first;
+		}
+	}
+	pthread_join(thread, 0);
+
+	ft::epoch_guard guard;
+
+	assert(before.size() == 50 && before.count(1) == 0);
+	assert(!m.insert(ft::make_pair(99, 0)) && m.at(99) == 1999);
+	assert(m.erase(99) == 1 && m.find(99) == m.end());
+	std::cout << "OK" << std::endl;
+}
+
+struct square
+{
+	long operator()(long x) const { return x * x; }
+};
+
+struct plus
+{
+	long operator()(long x, long y) const { return x + y; }
+};
+
+struct increment
+{
+	void operator()(ft::pair<const int, long> &p) const { ++p.second; }
+	void operator()(long &x) const { ++x; }
+};
+
+void test_22(void)
+{
+	ft::thread_pool									pool(3);
+	ft::vector<long>								v(100000);
+	ft::vector<long>								squares(v.size());
+	ft::map<int, long>								m;
+	ft::map<int, long, ft::less<int>,
+		std::allocator<ft::pair<const int, long> >,
+		ft::order_statistics>						ranked;
+
+	for (size_t i = 0; i < v.size(); ++i)
+		v[i] = i;
+	ft::parallel_for_each(v.begin(), v.end(), increment(), 1000, pool);
+	assert(ft::parallel_reduce(v.begin(), v.end(), 0L, plus(), 1000, pool) == 5000050000L);
+	assert(ft::parallel_transform(v.begin(), v.end(), squares.begin(), square(), 1000, pool)
+		== squares.end());
+	assert(squares[0] == 1 && squares[99999] == 10000000000L);
+
+	for (int i = 0; i < 10000; ++i) {
+		m[i] = i;
+		ranked[i] = i;
+	}
+	ft::parallel_for_each(m.begin(), m.end(), increment(), 100, pool);
+	ft::parallel_for_each(ranked.find(2500), ranked.find(7500), increment(), 100, pool);
+	for (int i = 0; i < 10000; ++i)
+		assert(m[i] == i + 1 && ranked[i] == i + (i >= 2500 && i < 7500));
+	std::cout << "OK" << std::endl;
+}
+
+void test_23(void)
+{
+	typedef ft::vector<std::string, std::allocator<std::string>, ft::operation_trace>	traced_vector;
+	typedef ft::map<int, int, ft::less<int>, std::allocator<ft::pair<const int, int> >,
+		ft::no_order_statistics, ft::operation_trace>									traced_map;
+
+	ft::trace_counts	global = ft::operation_trace::global();
+	traced_vector		v;
+	traced_map			m;
+
+	/* the buffer grows to 1, 2 and 4 elements, copying the old ones */
+	for (int i = 0; i < 4; ++i)
+		v.push_back("abc");
+	assert(v.trace().counts.copies == 7 && v.trace().counts.destructions == 3);
+	assert(v.trace().counts.allocations == 3 && v.trace().counts.comparisons == 0);
+
+	traced_vector copy(v);
+	assert(copy.trace().counts.copies == 4 && copy.trace().counts.allocations == 1);
+
+	for (int i = 0; i < 100; ++i)
+		m[i] = i;
+
+	ft::trace_counts before = m.trace().counts;
+
+	m.find(50);
+	assert((m.trace().counts - before).comparisons > 0);
+	assert((m.trace().counts - before).copies == 0);
+	m.erase(50);
+	assert(m.trace().counts.allocations == 100 && m.trace().counts.destructions == 1);
+
+	ft::trace_counts d = ft::operation_trace::global() - global;
+	assert(d.copies == 111 && d.allocations == 104);
+	std::cout << "OK" << std::endl;
+}
+
+void test_24(void)
+{
+	ft::select_map<long, int>::type		m;
+	ft::map<long, int>					ref;
+	ft::radix_map<long, int> const		&r = m;
+
+	assert(ft::is_integral<char>::value && ft::is_integral<const short>::value);
+	assert(ft::is_integral<int64_t>::value && !ft::is_integral<double>::value);
+	for (long i = -5000; i < 5000; ++i) {
+		long k = i * 7919 % 100003;
+
+		m[k] = i;
+		ref[k] = i;
+	}
+	m.erase(0);
+	ref.erase(0);
+	assert(m.size() == ref.size());
+	assert(ft::equal(ref.begin(), ref.end(), r.begin()));
+	assert(r.rbegin()->first == ref.rbegin()->first);
+	for (long k = -100010; k < 100010; k += 37) {
+		assert(r.count(k) == ref.count(k));
+		assert((r.lower_bound(k) == r.end()) == (ref.lower_bound(k) == ref.end()));
+		if (ref.lower_bound(k) != ref.end())
+			assert(r.lower_bound(k)->first == ref.lower_bound(k)->first);
+		if (ref.upper_bound(k) != ref.end())
+			assert(r.upper_bound(k)->first == ref.upper_bound(k)->first);
+	}
+	assert(r.at(-7919 % 100003) == -1);
+	assert((converts<ft::radix_map<long, int>::iterator, ft::radix_map<long, int>::const_iterator>::value));
+	assert(!(converts<ft::radix_map<long, int>::const_iterator, ft::radix_map<long, int>::iterator>::value));
+	std::cout << "OK" << std::endl;
+}
+
+struct by_fd { };
+
+struct connection : ft::intrusive_hook<>, ft::intrusive_hook<by_fd>
+{
+	int		id;
+	int		fd;
+};
+
+void test_25(void)
+{
+	typedef ft::intrusive_map<connection, ft::member_key<connection, int, &connection::id> >	by_id_map;
+	typedef ft::intrusive_map<connection, ft::member_key<connection, int, &connection::fd>,
+		ft::less<int>, by_fd>																by_fd_map;
+
+	ft::vector<connection>	pool(100);
+	by_id_map				ids;
+	by_fd_map				fds;
+
+	for (int i = 0; i < 100; ++i) {
+		pool[i].id = i * 37 % 100;
+		pool[i].fd = 1000 - i;
+		assert(ids.insert(pool[i]).second);
+		fds.insert(fds.begin(), pool[i]);
+	}
+
+	connection dup = pool[5];
+
+	assert(!ids.insert(dup).second && !static_cast<ft::intrusive_hook<> &>(dup).is_linked());
+	assert(ids.size() == 100 && fds.size() == 100);
+	assert(ids.begin()->id == 0 && fds.begin()->fd == 901);
+	assert(&*ids.find(37) == &pool[1] && &*fds.find(990) == &pool[10]);
+
+	/* erasing from the object itself, with no lookup */
+	for (int i = 0; i < 100; i += 2) {
+		ids.erase(pool[i]);
+		assert(!static_cast<ft::intrusive_hook<> &>(pool[i]).is_linked());
+	}
+	assert(ids.size() == 50 && fds.size() == 100);
+	assert(ids.count(0) == 0 && ids.count(37) == 1);
+	assert(ids.lower_bound(36)->id == 37 && ids.upper_bound(37)->id == 39);
+
+	int prev = -1;
+
+	for (by_id_map::const_iterator it = ids.begin(); it != ids.end(); ++it) {
+		assert(it->id > prev && it->id % 2);
+		prev = it->id;
+	}
+	assert(ids.iterator_to(pool[1]) == ids.find(37));
+	assert((converts<by_id_map::iterator, by_id_map::const_iterator>::value));
+	assert(!(converts<by_id_map::const_iterator, by_id_map::iterator>::value));
+	ids.clear();
+	fds.clear();
+	assert(!static_cast<ft::intrusive_hook<by_fd> &>(pool[1]).is_linked());
+	std::cout << "OK" << std::endl;
+}
+
+/* written by ft::perfect_hash_map_generate */
+ft::perfect_hash_map<char const *, int, 9, 16, 4> const methods = {
+	{
+		{ "GET", 0 },
+		{ "PUT", 1 },
+		{ "POST", 2 },
+		{ "DELETE", 3 },
+		{ "HEAD", 4 },
+		{ "OPTIONS", 5 },
+		{ "PATCH", 6 },
+		{ "TRACE", 7 },
+		{ "CONNECT", 8 }
+	},
+	1,
+	{ 2, 0, 0, 0 },
+	{ 0, 0, 7, 8, 0, 3, 0, 0, 4, 0, 2, 5, 1, 0, 6, 0 }
+};
+
+/* written by ft::perfect_hash_map_generate, from the extreme keys below */
+ft::perfect_hash_map<long long, int, 4, 4, 2> const signed_extremes = {
+	{
+		{ (-9223372036854775807LL - 1), 0 },
+		{ -1LL, 1 },
+		{ 0LL, 2 },
+		{ 9223372036854775807LL, 3 }
+	},
+	0,
+	{ 0, 0 },
+	{ 2, 1, 3, 0 }
+};
+
+ft::perfect_hash_map<unsigned long long, int, 4, 4, 2> const unsigned_extremes = {
+	{
+		{ 0ULL, 0 },
+		{ 1ULL, 1 },
+		{ 9223372036854775808ULL, 2 },
+		{ 18446744073709551615ULL, 3 }
+	},
+	2,
+	{ 0, 3 },
+	{ 2, 1, 3, 0 }
+};
+
+static long long const			signed_keys[] = { -0x7fffffffffffffffLL - 1, -1, 0, 0x7fffffffffffffffLL };
+static unsigned long long const	unsigned_keys[] = { 0, 1, 0x8000000000000000ULL, 0xffffffffffffffffULL };
+
+void test_26(void)
+{
+	char const							*keys[9];
+	ft::perfect_hash_layout<char const *>	layout;
+
+	for (size_t i = 0; i < methods.size(); ++i) {
+		keys[i] = methods.elements[i].first;
+		assert(methods.at(keys[i]) == static_cast<int>(i));
+		assert(&*methods.find(std::string(keys[i]).c_str()) == &methods.elements[i]);
+	}
+	assert(!methods.count("get") && !methods.count("") && methods.find("GETS") == methods.end());
+
+	/* the table above is still what the generator makes */
+	assert(layout.build(keys, 9) && layout.seed == methods.seed);
+	assert(ft::equal(layout.displacement.begin(), layout.displacement.end(), methods.displacement));
+	assert(ft::equal(layout.index.begin(), layout.index.end(), methods.index));
+
+	keys[8] = "GET";
+	assert(!layout.build(keys, 9));
+
+	/* the extreme keys are written as literals that compile as they are */
+	char const			*values[] = { "0", "1", "2", "3" };
+	std::ostringstream	generated;
+
+	for (int i = 0; i < 4; ++i) {
+		assert(signed_extremes.at(signed_keys[i]) == i);
+		assert(unsigned_extremes.at(unsigned_keys[i]) == i);
+	}
+	assert(ft::perfect_hash_map_generate(generated, "long long", "int", "signed_extremes",
+		signed_keys, values, 4));
+	assert(ft::perfect_hash_map_generate(generated, "unsigned long long", "int", "unsigned_extremes",
+		unsigned_keys, values, 4));
+	assert(generated.str().find("{ (-9223372036854775807LL - 1), 0 }") != std::string::npos);
+	assert(generated.str().find("{ 18446744073709551615ULL, 3 }") != std::string::npos);
+	std::cout << "OK" << std::endl;
+}
+
+/* A value whose copy throws once copies_left reaches 0. */
+struct fragile
+{
+	static int	copies_left;
+	static int	live;
+	int			value;
+
+	fragile(int v = 0) : value(v) { ++live; }
+	fragile(fragile const &x) : value(x.value)
+	{
+		if (copies_left >= 0 && copies_left-- == 0)
+			throw std::runtime_error("copy failed");
+		++live;
+	}
+	~fragile(void) { --live; }
+};
+
+int fragile::copies_left = -1;
+int fragile::live = 0;
+
+static bool same_contents(ft::persistent_map<int, fragile> const &map, ft::map<int, int> const &ref)
+{
+	ft::map<int, int>::const_iterator it = ref.begin();
+
+	if (map.size() != ref.size())
+		return false;
+	for (ft::persistent_map<int, fragile>::iterator x = map.begin(); x != map.end(); ++x, ++it) {
+		if (x->first != it->first || x->second.value != it->second)
+			return false;
+	}
+	return true;
+}
+
+void test_27(void)
+{
+	typedef ft::persistent_map<int, fragile>	fragile_map;
+	typedef fragile_map::value_type				value_type;
+
+	/* every update fails at each of its copies in turn, on a map that
+	 * is updated in place, then on one that shares its nodes */
+	for (int shared = 0; shared < 2; ++shared) {
+		for (int n = 0; n < 8; ++n) {
+			fragile_map			map;
+			ft::map<int, int>	ref;
+
+			for (int i = 0; i < 64; ++i) {
+				map.insert(value_type(i, fragile(i)));
+				ref[i] = i;
+			}
+
+			fragile_map snap = shared ? map.snapshot() : fragile_map();
+
+			for (int k = 0; k < 64; k += 3) {
+				value_type inserted(k + 64, fragile(k));
+				value_type assigned(k, fragile(-k));
+
+				fragile::copies_left = n;
+				try {
+					map.insert(inserted);
+					ref[k + 64] = k;
+				} catch (std::runtime_error const &) { }
+				fragile::copies_left = n;
+				try {
+					map.assign(assigned);
+					ref[k] = -k;
+				} catch (std::runtime_error const &) { }
+				fragile::copies_left = n;
+				try {
+					map.erase(k + 1);
+					ref.erase(k + 1);
+				} catch (std::runtime_error const &) { }
+				fragile::copies_left = -1;
+				assert(same_contents(map, ref));
+			}
+			assert(snap.size() == (shared ? 64u : 0u));
+		}
+	}
+	std::cout << "OK" << std::endl;
+}
+
+void test_28(void)
+{
+	typedef ft::static_vector<fragile, 8>	fragile_vector;
+
+	for (int n = 0; n < 3; ++n) {
+		{
+			fragile_vector	vct;
+			fragile			more[3] = { fragile(7), fragile(8), fragile(9) };
+
+			for (int i = 0; i < 4; ++i)
+				vct.push_back(fragile(i));
+			fragile::copies_left = n;
+			try {
+				vct.insert(vct.begin() + 1, 3, fragile(42));
+				assert(false);
+			} catch (std::runtime_error const &) { }
+			fragile::copies_left = n;
+			try {
+				vct.insert(vct.begin() + 2, more, more + 3);
+				assert(false);
+			} catch (std::runtime_error const &) { }
+			fragile::copies_left = -1;
+			assert(vct.size() == 4);
+			for (int i = 0; i < 4; ++i)
+				assert(vct[i].value == i);
+			vct.insert(vct.begin() + 1, more, more + 3);
+			assert(vct.size() == 7 && vct[1].value == 7 && vct[3].value == 9 && vct[4].value == 1);
+			fragile::copies_left = n;
+			try {
+				fragile_vector copy(vct);
+				assert(false);
+			} catch (std::runtime_error const &) { }
+			fragile::copies_left = -1;
+		}
+		assert(fragile::live == 0);
+	}
+
+	/* single-pass input */
+	std::istringstream			in("1 2 3 4 5");
+	ft::static_vector<int, 8>	vct(2, 0);
+
+	vct.insert(vct.begin() + 1, std::istream_iterator<int>(in), std::istream_iterator<int>());
+	assert(vct.size() == 7 && vct[0] == 0 && vct[1] == 1 && vct[5] == 5 && vct[6] == 0);
+	std::cout << "OK" << std::endl;
+}
+
+#ifdef FT_DEBUG_ITERATORS
+/* Runs f in a child process and returns whether it aborted. */
+static bool aborts(void (*f)(void))
+{
+	pid_t	pid = fork();
+	int		status;
+
+	if (pid == 0) {
+		freopen("/dev/null", "w", stderr);
+		f();
+		_exit(0);
+	}
+	waitpid(pid, &status, 0);
+	return WIFSIGNALED(status) && WTERMSIG(status) == SIGABRT;
+}
+
+static void read_after_reallocation(void)
+{
+	ft::vector<int>				vct(4, 1);
+	ft::vector<int>::iterator	it = vct.begin();
+
+	vct.reserve(64);
+	volatile int x = *it;
+	(void)x;
+}
+
+static void read_past_erased_end(void)
+{
+	ft::vector<int>					vct(4, 1);
+	ft::vector<int>::const_iterator	it = vct.end() - 1;
+
+	vct.pop_back();
+	volatile int x = *it;
+	(void)x;
+}
+#endif
+
+/* Also build with -DFT_DEBUG_ITERATORS: stale iterators must then abort. */
+void test_29(void)
+{
+	typedef ft::vector<int>	int_vector;
+
+	int_vector	vct;
+	int			expected = 9;
+
+	for (int i = 0; i < 10; ++i)
+		vct.push_back(i);
+	for (int_vector::reverse_iterator it = vct.rbegin(); it != vct.rend(); ++it)
+		assert(*it == expected--);
+	assert(expected == -1 && vct.rbegin().base() == vct.end());
+
+	int_vector::const_iterator cit = vct.begin() + 4;
+
+	assert(*cit == 4 && cit[2] == 6 && cit - vct.begin() == 4);
+	assert(2 + cit == vct.begin() + 6 && cit < vct.end());
+	assert(*int_vector::const_reverse_iterator(cit) == 3);
+	assert(ft::is_trivially_copyable<int_vector::iterator>::value);
+	assert(ft::is_trivially_copyable<int_vector::reverse_iterator>::value);
+#ifdef FT_DEBUG_ITERATORS
+	assert(aborts(read_after_reallocation));
+	assert(aborts(read_past_erased_end));
+#else
+	assert(sizeof(int_vector::iterator) == sizeof(int *));
+	assert(sizeof(int_vector::reverse_iterator) == sizeof(int *));
+#endif
+	std::cout << "OK" << std::endl;
+}
+
+void test_30(void)
+{
+	ft::incremental_vector<int> vct;
+
+	for (int i = 0; i < 16; ++i)
+		vct.push_back(i);
+
+	/* the elements must all migrate before the buffer fills */
+	vct.reserve(17);
+	assert(vct.migrating() && vct.capacity() == 20);
+
+	/* a reserve made while migrating waits for the migration */
+	vct.reserve(1000);
+	assert(vct.migrating() && vct.capacity() == 20);
+	for (int i = 16; i < 20; ++i)
+		vct.push_back(i);
+	assert(vct.size() == 20 && vct.capacity() == 1000 && vct.migrating());
+	while (vct.migrating())
+		vct.push_back(vct.size());
+	for (size_t i = 0; i < vct.size(); ++i)
+		assert(vct[i] == static_cast<int>(i));
+	std::cout << "OK" << std::endl;
+}
+
+/* Walks map both ways through the threaded links and compares it with ref. */
+template <class Map>
+static bool same_order(Map const &map, std::map<int, int> const &ref)
+{
+	typename Map::const_iterator				it = map.begin();
+	std::map<int, int>::const_iterator			x = ref.begin();
+	std::map<int, int>::const_reverse_iterator	rx = ref.rbegin();
+
+	if (map.size() != ref.size())
+		return false;
+	for (; x != ref.end(); ++x, ++it) {
+		if (it == map.end() || it->first != x->first || it->second != x->second)
+			return false;
+	}
+	if (it != map.end())
+		return false;
+	while (it != map.begin()) {
+		--it;
+		if (it->first != rx->first)
+			return false;
+		++rx;
+	}
+	return rx == ref.rend();
+}
+
+void test_31(void)
+{
+	typedef ft::map<int, int>	int_map;
+
+	int_map				map;
+	std::map<int, int>	ref;
+	unsigned			seed = 7;
+
+	assert(map.begin() == map.end() && same_order(map, ref));
+	for (int i = 0; i < 2000; ++i) {
+		seed = seed * 1103515245 + 12345;
+
+		int k = seed >> 16 & 511;
+
+		if (seed & 0x100) {
+			map[k] = i;
+			ref[k] = i;
+		} else {
+			map.erase(k);
+			ref.erase(k);
+		}
+	}
+	assert(same_order(map, ref));
+	assert(++(--map.end()) == map.end());
+
+	int_map cpy(map);
+
+	assert(same_order(cpy, ref));
+	cpy.erase(cpy.begin(), cpy.lower_bound(256));
+	cpy.compact();
+
+	std::map<int, int> high(ref.lower_bound(256), ref.end());
+
+	assert(same_order(cpy, high));
+	map.swap(cpy);
+	assert(same_order(map, high) && same_order(cpy, ref));
+
+	int_map low = cpy.split(256);
+
+	assert(same_order(cpy, std::map<int, int>(ref.begin(), ref.lower_bound(256))));
+	assert(same_order(low, high));
+	cpy.join(low);
+	assert(same_order(cpy, ref) && low.empty() && low.begin() == low.end());
+
+	int_map::node_type nh = cpy.extract(cpy.begin());
+
+	nh.key() = 1000;
+	cpy.insert(nh);
+	ref[1000] = ref.begin()->second;
+	ref.erase(ref.begin());
+	assert(same_order(cpy, ref));
+
+	map.clear();
+	map[1] = 1;
+	map.merge(cpy);
+	ref[1] = 1;
+	assert(same_order(map, ref) && same_order(cpy, std::map<int, int>()));
+	map = cpy;
+	assert(map.empty() && map.begin() == map.end());
+	std::cout << "OK" << std::endl;
+}
+
+/* A size class of its own, so that the cache starts empty. */
+struct cached_block
+{
+	char	bytes[200];
+};
+
+typedef ft::caching_allocator<cached_block>	block_allocator;
+
+static cached_block	*kept[2];
+
+static void *allocate_two(void *)
+{
+	block_allocator alloc;
+
+	kept[0] = alloc.allocate(1);
+	kept[1] = alloc.allocate(1);
+	return 0;
+}
+
+static void *allocate_thirty(void *)
+{
+	block_allocator	alloc;
+	cached_block	*blocks[30];
+
+	for (int i = 0; i < 30; ++i)
+		blocks[i] = alloc.allocate(1);
+	for (int i = 0; i < 30; ++i)
+		alloc.deallocate(blocks[i], 1);
+	return 0;
+}
+
+void test_32(void)
+{
+	block_allocator	alloc;
+	pthread_t		thread;
+	cached_block	*blocks[100];
+
+	/* the first thread leaves a batch of 30 blocks in the depot, the
+	 * second takes it, and both hand their lists back on exit */
+	pthread_create(&thread, 0, allocate_two, 0);
+	pthread_join(thread, 0);
+	pthread_create(&thread, 0, allocate_thirty, 0);
+	pthread_join(thread, 0);
+
+	for (int i = 0; i < 100; ++i) {
+		blocks[i] = alloc.allocate(1);
+		blocks[i]->bytes[0] = i;
+		assert(blocks[i] != kept[0] && blocks[i] != kept[1]);
+	}
+	for (int i = 0; i < 100; ++i) {
+		assert(blocks[i]->bytes[0] == i);
+		alloc.deallocate(blocks[i], 1);
+	}
+	alloc.deallocate(kept[0], 1);
+	alloc.deallocate(kept[1], 1);
+	std::cout << "OK" << std::endl;
+}
+
+void test_33(void)
+{
+	typedef ft::soa_vector<int, fragile>	fragile_soa;
+
+	fragile_soa				v;
+	fragile_soa::value_type	x(42, fragile(42));
+
+	for (int i = 0; i < 8; ++i)
+		v.push_back(i, fragile(i));
+	v.reserve(32);
+
+	/* the second column fails, the first must shrink back */
+	fragile::copies_left = 0;
+	try {
+		v.insert(v.begin() + 3, x);
+		assert(false);
+	} catch (std::runtime_error const &) { }
+	fragile::copies_left = 2;
+	try {
+		v.resize(12, x);
+		assert(false);
+	} catch (std::runtime_error const &) { }
+	fragile::copies_left = -1;
+	assert(v.size() == 8 && v.first_column().size() == v.second_column().size());
+	for (int i = 0; i < 8; ++i)
+		assert(v[i].first == i && v[i].second.value == i);
+
+	v.insert(v.begin() + 3, x);
+	v.resize(12, x);
+	assert(v.size() == 12 && v[3].second.value == 42 && v[4].first == 3 && v[11].first == 42);
+	std::cout << "OK" << std::endl;
+}
+
+void test_34(void)
+{
+	typedef ft::map<int, int, ft::less<int>, counting_allocator<ft::pair<const int, int> > >	counted_map;
+
+	{
+		counted_map m;
+
+		for (int i = 0; i < 100; ++i)
+			m[i] = i;
+		m.compact();
+		assert(allocated_blocks == 1);
+
+		/* the block goes with its last element, the new node stays */
+		m[1000] = 1000;
+		for (int i = 0; i < 99; ++i)
+			m.erase(i);
+		assert(allocated_blocks == 2);
+		m.erase(99);
+		assert(allocated_blocks == 1 && m.size() == 1 && m.begin()->first == 1000);
+
+		m.compact();
+		for (int i = 0; i < 10; ++i)
+			m[i] = i;
+
+		counted_map other;
+
+		other.swap(m);
+		assert(other.size() == 11 && m.empty() && m.begin() == m.end());
+		other.clear();
+		assert(allocated_blocks == 0);
+		other.swap(m);
+		other[5] = 5;
+	}
+	assert(allocated_blocks == 0);
+	std::cout << "OK" << std::endl;
+}
+
+/* Another size class of its own. */
+struct freed_block
+{
+	char	bytes[232];
+};
+
+static freed_block	*freed[40];
+
+static void *deallocate_forty(void *)
+{
+	ft::caching_allocator<freed_block> alloc;
+
+	for (int i = 0; i < 40; ++i)
+		alloc.deallocate(freed[i], 1);
+	return 0;
+}
+
+void test_35(void)
+{
+	ft::caching_allocator<freed_block>	alloc;
+	pthread_t							thread;
+	freed_block							*blocks[64];
+	int									reused = 0;
+
+	/* a thread that only frees, and too few blocks to give a batch
+	 * back, still hands its list back on exit */
+	for (int i = 0; i < 40; ++i)
+		freed[i] = alloc.allocate(1);
+	pthread_create(&thread, 0, deallocate_forty, 0);
+	pthread_join(thread, 0);
+
+	/* the 24 blocks left in the list of this thread, then the 40 */
+	for (int i = 0; i < 64; ++i) {
+		blocks[i] = alloc.allocate(1);
+		reused += std::find(freed, freed + 40, blocks[i]) != freed + 40;
+	}
+	assert(reused == 40);
+	for (int i = 0; i < 64; ++i)
+		alloc.deallocate(blocks[i], 1);
+	std::cout << "OK" << std::endl;
+}
+
 int main(void)
 {
 	test_01();
 	test_02();
 	test_03();
+	test_05();
+	test_06();
+	test_07();
+	test_08();
+	test_09();
+	test_10();
+	test_11();
+	test_12();
+	test_13();
+	test_14();
+	test_15();
+	test_16();
+	test_17();
+	test_18();
+	test_19();
+	test_20();
+	test_21();
+	test_22();
+	test_23();
+	test_24();
+	test_25();
+	test_26();
+	test_27();
+	test_28();
+	test_29();
+	test_30();
+	test_31();
+	test_32();
+	test_33();
+	test_34();
+	test_35();
 }